@@ -4,6 +4,8 @@
 #include <map>
 #include "graph_translators.hpp"
 #include "automation.hpp"
+#include "analysis_control.hpp"
+#include "graph_export.hpp"
 
 using namespace std;
 
@@ -12,24 +14,38 @@ class Node{
 public:
     map<string, int> data;									//словарь маркировок
     Node* parent;											//родительский узел
+    int event = -1;											//номер перехода, ведущего из родительского узла
     Node(map<string, int> d) { parent = NULL; data = d; };	//конструктор, создающий начальный узел
     Node(Node* par, map<string, int> d);					//конструктор, создающий новый узел по родителю и маркировке
     Node() {};												//конструктор по умолчанию
 };
 
+//Рабочее состояние одного вызова анализа
+struct AnalysisContext {
+    int term = 0;					//счетчик терминальных вершин
+    map< map<string, int>, int > close;	//закрытые вершины и их номера в дереве
+    set< map<string, int> > open;	//множество открытых вершин
+    int dubl_start = 0;				//счетчик вершин, дублирующих начальную
+    int omega_nodes = 0;			//счетчик вершин с неограниченными позициями
+    set <string> done_events;		//множество выполненных переходов
+    map<int, Node> tree;			//дерево
+    vector<string> event_names;		//имена переходов по номерам
+    Node* deadlock_node = nullptr;	//первая терминальная вершина
+    Node* omega_node = nullptr;		//первая вершина с неограниченными позициями
+    int current = 0;				//номер обрабатываемой вершины
+    des::GraphExporter* exporter = nullptr;	//выгрузка графа достижимости или нулевой указатель
+};
+
 //Класс анализатора
+//Анализатор не хранит состояния: все рабочие данные находятся в контексте вызова,
+//поэтому один объект можно использовать одновременно из нескольких потоков.
 class Analyser {
-	private:
-		int term = 0;					//счетчик терминальных вершин
-		set< map<string, int> > close;	//множество закрытых вершин
-		set< map<string, int> > open;	//множество открытых вершин
-		int dubl_start = 0;				//счетчик вершин, дублирующих начальную
-		set <string> done_events;		//множество выполненных переходов
-		map<int, Node> tree;			//дерево
-
 	public:
 		Analyser() {};											//конструктор по умолчанию
-		void analyse_node(Node* start, des::Automation& model);	//метод обработки вершины дерева
-		map<string, bool> run_analyse(des::Automation& model);	//метод анализа сети Петри
-		int bfs(des::Automation& model);						//метод анализа сети на связность
-};
\ No newline at end of file
+		void analyse_node(Node* start, const des::Automation& model, AnalysisContext& context) const;	//метод обработки вершины дерева
+		des::AnalysisResult run_analyse(const des::Automation& model, const des::AnalysisOptions& options = des::AnalysisOptions()) const;	//метод анализа сети Петри
+		vector<des::AnalysisResult> run_batch(const vector<des::Automation>& models, const des::AnalysisOptions& options = des::AnalysisOptions(), unsigned threads = 0) const;	//метод параллельного анализа нескольких сетей Петри
+		int bfs(const des::Automation& model) const;						//метод анализа сети на связность
+		int bfs(const des::Automation& model, set<string>& unvisited) const;	//метод анализа сети на связность с множеством недостижимых вершин
+		des::Witness witness(const Node* node, const AnalysisContext& context) const;	//метод восстановления последовательности срабатываний до вершины
+};
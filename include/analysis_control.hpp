@@ -0,0 +1,184 @@
+/*! @file analysis_control.hpp
+Analysis options, limits and result types header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef ANALYSIS_CONTROL_HPP
+#define ANALYSIS_CONTROL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "compiled_net.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  class GraphExporter;
+  class ResultCache;
+
+  /*! Class of a cancellation flag shared between analysis and other threads.
+  @details The analysis checks the flag between processed markings and stops with @ref AnalysisStatus::cancelled
+  status, when the flag is set. */
+  class CancellationToken {
+  public:
+
+    /*! Requests cancellation of all analyses using the token. */
+    inline void cancel() noexcept {
+      _cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    /*! Clears the cancellation request. */
+    inline void reset() noexcept {
+      _cancelled.store(false, std::memory_order_relaxed);
+    }
+
+    /*! Returns true, if cancellation is requested.
+    @return State of the cancellation flag. */
+    [[nodiscard]] inline bool isCancelled() const noexcept {
+      return _cancelled.load(std::memory_order_relaxed);
+    }
+
+  private:
+
+    std::atomic<bool> _cancelled = false; ///< Cancellation flag.
+
+  }; // CancellationToken class
+
+  /*! Structure of live statistics passed to progress callback. */
+  struct AnalysisProgress {
+    size_t States = 0;                        ///< Quantity of explored markings.
+    size_t Frontier = 0;                      ///< Quantity of markings waiting for exploration.
+    double StatesPerSecond = 0.0;             ///< Average exploration rate.
+    size_t Memory = 0;                        ///< Estimated memory of stored markings in bytes.
+    size_t OmegaNodes = 0;                    ///< Quantity of markings with unbounded states.
+    size_t Depth = 0;                         ///< Depth of the current marking.
+    std::chrono::milliseconds Elapsed{ 0 };   ///< Wall-clock time from the start of analysis.
+  };
+
+  /*! Type of progress callback. */
+  using ProgressCallback = std::function<void(const AnalysisProgress&)>;
+
+  /*! Structure of analysis limits.
+  @details This structure contains limits of the analysis resources and progress reporting settings. Zero value of a
+  limit means no limit. Memory is estimated as the size of markings stored by the analysis. The progress callback is
+  invoked from the analysing thread not more often than the interval and once after the analysis. Without callback the
+  analysis doesn't read the clock for progress reporting. The result cache is used by @ref Analyser::run_analyse only:
+  a cached result is returned without analysis, a new result is stored into the cache. The graph exporter receives
+  markings and fired events of the explored state space during the analysis, the cache isn't searched with it. */
+  struct AnalysisOptions {
+    size_t MaxMemory = 0;                                ///< Limit of memory for stored markings in bytes.
+    std::chrono::milliseconds TimeLimit{ 0 };            ///< Limit of wall-clock time.
+    size_t MaxStates = 0;                                ///< Limit of explored markings.
+    const CancellationToken* Cancellation = nullptr;     ///< Cancellation token or null pointer.
+    ProgressCallback Progress = nullptr;                 ///< Progress callback or empty function.
+    std::chrono::milliseconds ProgressInterval{ 1000 };  ///< Min interval between progress callback calls.
+    ResultCache* Cache = nullptr;                        ///< Cache of results or null pointer.
+    GraphExporter* Exporter = nullptr;                   ///< Exporter of the reachability graph or null pointer.
+  };
+
+  /*! Enumeration of analysis completion statuses. */
+  enum class AnalysisStatus {
+    complete,    ///< State space is explored exhaustively.
+    memoryLimit, ///< Analysis is stopped by @ref AnalysisOptions::MaxMemory limit.
+    timeLimit,   ///< Analysis is stopped by @ref AnalysisOptions::TimeLimit limit.
+    stateLimit,  ///< Analysis is stopped by @ref AnalysisOptions::MaxStates limit.
+    cancelled    ///< Analysis is stopped by @ref CancellationToken.
+  };
+
+  /*! Returns name of analysis status.
+  @param s Analysis status.
+  @return Name of the status. */
+  inline const char* toString(const AnalysisStatus& s) noexcept {
+    switch (s) {
+      case AnalysisStatus::complete: return "complete";
+      case AnalysisStatus::memoryLimit: return "memory limit";
+      case AnalysisStatus::timeLimit: return "time limit";
+      case AnalysisStatus::stateLimit: return "state limit";
+      case AnalysisStatus::cancelled: return "cancelled";
+    }
+    return "unknown";
+  }
+
+  /*! Enumeration of verdict values.
+  @details Verdict is unknown, if the analysis is stopped by a limit before the property is decided. */
+  enum class Verdict {
+    unknown, ///< Property isn't decided.
+    yes,     ///< Property holds.
+    no       ///< Property is violated.
+  };
+
+  /*! Returns name of verdict value.
+  @param v Verdict value.
+  @return Name of the verdict. */
+  inline const char* toString(const Verdict& v) noexcept {
+    switch (v) {
+      case Verdict::yes: return "yes";
+      case Verdict::no: return "no";
+      default: return "unknown";
+    }
+  }
+
+  /*! Structure of a witness of property violation.
+  @details This structure contains firing sequence from the initial marking and the marking reached by this sequence.
+  Unbounded states of the marking have @ref omega tokens. */
+  struct Witness {
+    std::vector<std::string> Events = {};         ///< Firing sequence from the initial marking.
+    std::map<std::string, unsigned> Marking = {}; ///< Reached marking.
+  };
+
+  /*! Structure of analysis statistics. */
+  struct AnalysisStatistics {
+    size_t States = 0;                         ///< Quantity of explored markings.
+    size_t Frontier = 0;                       ///< Quantity of markings waiting for exploration.
+    size_t TerminalStates = 0;                 ///< Quantity of markings without ready events.
+    size_t OmegaNodes = 0;                     ///< Quantity of markings with unbounded states.
+    size_t Memory = 0;                         ///< Estimated memory of stored markings in bytes.
+    size_t PeakMemory = 0;                     ///< Estimated peak memory of stored markings in bytes.
+    std::chrono::milliseconds Duration{ 0 };   ///< Wall-clock time of analysis.
+  };
+
+  /*! Structure of analysis phase timings. */
+  struct AnalysisTimings {
+    std::chrono::microseconds Exploration{ 0 };  ///< Construction of the coverability tree.
+    std::chrono::microseconds Verdicts{ 0 };     ///< Check of liveness, reachability and safety on the tree.
+    std::chrono::microseconds Connectivity{ 0 }; ///< Check of the net graph connectivity.
+  };
+
+  /*! Structure of analysis result.
+  @details This structure contains verdicts, witnesses of violations, completion status, statistics and timings of
+  the analysis. The net is alive, if there are no terminal markings and every event fires at least once; coherent, if
+  its graph is connected; safe, if there are no unbounded states; reachable, if the initial marking is reachable again.
+  If the analysis is stopped by a limit, the result is inconclusive and only verdicts decided by the explored part of
+  the state space are known. */
+  struct AnalysisResult {
+    Verdict Alive = Verdict::unknown;                 ///< Liveness verdict.
+    Verdict Coherent = Verdict::unknown;              ///< Connectivity verdict.
+    Verdict Safe = Verdict::unknown;                  ///< Safety (boundedness) verdict.
+    Verdict Reachable = Verdict::unknown;             ///< Reachability of the initial marking verdict.
+    std::optional<Witness> Deadlock = std::nullopt;   ///< Path to a terminal marking.
+    std::optional<Witness> Unbounded = std::nullopt;  ///< Path to a marking with unbounded states.
+    std::set<std::string> DeadEvents = {};            ///< Events never fired in the explored state space.
+    std::set<std::string> Disconnected = {};          ///< States and events unreachable in the net graph.
+    AnalysisStatus Status = AnalysisStatus::complete; ///< Completion status.
+    AnalysisStatistics Statistics = {};               ///< Statistics of the analysis.
+    AnalysisTimings Timings = {};                     ///< Timings of the analysis phases.
+
+    /*! Returns true for analysis stopped by a limit.
+    @return Result of the status check. */
+    [[nodiscard]] inline bool inconclusive() const noexcept {
+      return Status != AnalysisStatus::complete;
+    }
+  };
+
+} // namespace
+
+
+#endif // ANALYSIS_CONTROL_HPP
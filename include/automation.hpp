@@ -8,18 +8,29 @@
 
 #include <algorithm>
 #include <exception>
+#include <iosfwd>
 #include <limits>
 #include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <set>
 #include <string>
+#include <vector>
 
+#include "change_journal.hpp"
 #include "event.hpp"
+#include "fingerprint.hpp"
+#include "shared_dictionary.hpp"
 #include "state.hpp"
 
 
 /// Namespace of DES model.
 namespace des {
 
+  class AutomationBuilder;
+  class CompiledNet;
+
   /*! Class of an automation (state machine) corresponding to a Petri net.
   @details This class contains dictionaries with states, events and their relations. The states are @ref State objects
   and they correspond to Petri net places and can have activity tokens as Petri net tokens. The events are @ref Event
@@ -27,20 +38,48 @@ namespace des {
   a unique (within an automation) name, input and output links. Input links of an event are output links of a state and
   input links of a state are an output links of an event. The links between states and events form transition graph of
   an automation. There aren't links between two states or links between two events. Quantity of links and quantity of
-  activity tokens in each state are limited to UINT_MAX value. */
+  activity tokens in each state are limited to UINT_MAX value. Dictionaries of states and events are
+  @ref SharedDictionary objects, so copies of the automation share unchanged states and events and a copy takes
+  constant time. Changed states and events are copied on write. Data of dictionaries is allocated from the memory
+  resource of the automation, so a net can be placed into one arena (for example std::pmr::monotonic_buffer_resource)
+  and released at once. Names longer than the small string buffer and data of @ref ColdStorage use the global heap. The
+  automation keeps its structural @ref Fingerprint up to date after each change. The optional change log (see
+  @ref ChangeJournal) records every change as a compact record, the log is shared by copies as their common history,
+  so changes made after a snapshot or a version are found without comparison of the snapshot and the automation. */
   class Automation {
   public:
 
-    /*! Constructs an @ref Automation object by copying of other Automation object. */
-    Automation(const Automation&) = default;
+    /*! Constructs an @ref Automation object by copying of other Automation object.
+    @details The copy shares all states and events with the original and takes constant time, except states and events
+    returned by @ref getState and @ref getEvent methods of the original. They are copied, so changes through references
+    held by the original don't reach the copy.
+    @param a Automation object for copying. */
+    Automation(const Automation& a);
 
     /*! Constructs an @ref Automation object by moving of other Automation object. */
     Automation(Automation&&) = default;
 
     /*! Constructs an empty @ref Automation object.
-    @details Default constructor creates an @ref Automation object without states and events. */
+    @details Default constructor creates an @ref Automation object without states and events, which uses the default
+    memory resource. */
     Automation();
 
+    /*! Constructs an empty @ref Automation object with specified memory resource.
+    @param r Memory resource, it must outlive the automation. */
+    explicit Automation(std::pmr::memory_resource* r);
+
+    /*! Constructs an @ref Automation object by copying of other Automation object into specified memory resource.
+    @details All states and events are copied, nothing is shared with the original.
+    @param a Automation object for copying.
+    @param r Memory resource, it must outlive the automation. */
+    Automation(const Automation& a, std::pmr::memory_resource* r);
+
+    /*! Returns memory resource of the automation.
+    @return Pointer to the memory resource. */
+    [[nodiscard]] inline std::pmr::memory_resource* resource() const noexcept {
+      return _states.resource();
+    }
+
     /*! Adds new unconnected state into the automation.
     @details This method validates the name @a n by @ref checkNameString function, check uniqueness of name, creates
     and adds new state into the automation.
@@ -69,10 +108,12 @@ namespace des {
     @param n Name of state for check.
     @return Result of the state name check. */
     [[nodiscard]] inline bool checkState(const std::string& n) const noexcept {
-      return _states.find(n) != _states.end();
+      return _states.find(n) != nullptr;
     }
 
     /*! Returns existing state of the automation by name.
+    @details The state is copied, if it's shared with other copies of the automation. The state can be changed through
+    the reference, so it's fingerprinted anew by each @ref fingerprint call until its removal.
     @param n Name of state.
     @return Reference to the existing state.
     @throw std::invalid_argument Nonexistent state name. */
@@ -83,7 +124,10 @@ namespace des {
     @return Copy of the existing state.
     @throw std::invalid_argument Nonexistent state name. */
     [[nodiscard]] inline State getStateCopy(const std::string& n) const {
-      return const_cast<Automation*>(this)->getState(n);
+      if (const auto* state = _states.find(n)) {
+        return state->Component;
+      }
+      throw std::invalid_argument("getStateCopy: state name doesn't exist");
     }
 
     /*! Returns quantity of states in the automation.
@@ -106,10 +150,8 @@ namespace des {
     @param n Name of state.
     @return Quantity of activity tokens. */
     [[nodiscard]] inline unsigned getActivity(const std::string& n) const noexcept {
-      if (_states.find(n) != _states.end()) {
-        return _states.at(n).Component.activity();
-      }
-      return 0;
+      const auto* state = _states.find(n);
+      return state ? state->Component.activity() : 0;
     }
 
     /*! Returns quantity of input links for specified state.
@@ -134,8 +176,9 @@ namespace des {
 
     /*! Removes state from the automation.
     @details This method removes state with specified name. Nothing happens, if the required state doesn't exist.
-    @param n Name of removing state. */
-    void removeState(const std::string& n) noexcept;
+    @param n Name of removing state.
+    @throw std::bad_alloc Shared data of the state or its linked components can't be copied on write. */
+    void removeState(const std::string& n);
 
     /*! Adds new unconnected event into the automation.
     @details This method validates the name @a n by @ref checkNameString function, check uniqueness of name, creates
@@ -167,10 +210,12 @@ namespace des {
     @param n Name of event for check.
     @return Result of the event name check. */
     [[nodiscard]] inline bool checkEvent(const std::string& n) const noexcept {
-      return _events.find(n) != _events.end();
+      return _events.find(n) != nullptr;
     }
 
     /*! Returns existing event of the automation by name.
+    @details The event is copied, if it's shared with other copies of the automation. The event can be changed through
+    the reference, so it's fingerprinted anew by each @ref fingerprint call until its removal.
     @param n Name of event.
     @return Reference to the existing event.
     @throw std::invalid_argument Nonexistent event name. */
@@ -181,7 +226,10 @@ namespace des {
     @return Copy of the existing event.
     @throw std::invalid_argument Nonexistent event name. */
     [[nodiscard]] inline Event getEventCopy(const std::string& n) const {
-      return const_cast<Automation*>(this)->getEvent(n);
+      if (const auto* event = _events.find(n)) {
+        return event->Component;
+      }
+      throw std::invalid_argument("getEventCopy: event name doesn't exist");
     }
 
     /*! Returns quantity of events in the automation.
@@ -222,8 +270,9 @@ namespace des {
 
     /*! Removes event from the automation.
     @details This method removes event with specified name. Nothing happens, if the required event doesn't exist.
-    @param n Name of removing event. */
-    void removeEvent(const std::string& n) noexcept;
+    @param n Name of removing event.
+    @throw std::bad_alloc Shared data of the event or its linked components can't be copied on write. */
+    void removeEvent(const std::string& n);
 
     /*! Changes link from state to event.
     @details This method sets the multiplicity @a m for link from the state named @a s to the event named @a e in the
@@ -285,21 +334,112 @@ namespace des {
     @throw std::invalid_argument Invalid name of firing event. */
     void fire(const std::string& e = "");
 
+    /*! Returns copy of the automation sharing all states and events.
+    @details This method takes constant time and memory, except states and events returned by @ref getState and
+    @ref getEvent methods, which are copied. The snapshot and the automation are independent: a change of one of them,
+    including a change through a reference held by the automation, copies changed states and events and a small part of
+    dictionaries only. Snapshots can be used in different threads, which don't change the same object.
+    @return Snapshot of the automation. */
+    [[nodiscard]] Automation snapshot() const;
+
+    /*! Returns structural fingerprint of the automation.
+    @details The fingerprint covers names of states and events, activity tokens of states, types of events and
+    multiplicities of links. It's updated incrementally by all changing methods, so this method takes constant time,
+    except states and events returned by @ref getState and @ref getEvent methods, which are fingerprinted anew. Equal
+    automations have equal fingerprints regardless of order of changes.
+    @return Fingerprint. */
+    [[nodiscard]] Fingerprint fingerprint() const noexcept;
+
+    /*! Returns quantity of changes of the automation since its creation.
+    @return Version of the automation. */
+    [[nodiscard]] inline uint64_t version() const noexcept {
+      return _journal.version();
+    }
+
+    /*! Starts recording of changes, nothing happens, if the change log is enabled already. */
+    void enableChangeLog();
+
+    /*! Stops recording of changes and releases the change log. */
+    void disableChangeLog() noexcept;
+
+    /*! Returns true for the automation recording changes.
+    @return State of the change log. */
+    [[nodiscard]] inline bool isChangeLogEnabled() const noexcept {
+      return _journal.enabled();
+    }
+
+    /*! Returns changes made after a snapshot of the automation.
+    @details This method follows the change log from the last change to the last change of the snapshot, so it takes
+    time proportional to quantity of returned changes. The snapshot is a copy made, while the change log is enabled.
+    @param a Snapshot of the automation.
+    @return Changes in order of their making or std::nullopt, if the automation isn't a changed copy of @a a with the
+    same change log. */
+    [[nodiscard]] std::optional<std::vector<Change>> getChangesSince(const Automation& a) const;
+
+    /*! Returns changes made after specified version.
+    @details Changes are returned from the compact change log, so this method takes time proportional to quantity of
+    returned changes. Consumers keeping derived data (compiled nets, exported graphs, analysis results) can store the
+    version, which their data corresponds to, and apply the changes made after it. The last change of each batch closed
+    by @ref commitChanges is marked by the @ref Change::Commit flag.
+    @param v Version of the automation.
+    @return Changes in order of their making or std::nullopt, if the change log doesn't cover version @a v. */
+    [[nodiscard]] std::optional<std::vector<Change>> getChangesSince(uint64_t v) const;
+
+    /*! Returns flags of parts of the automation changed after specified version.
+    @details This method takes time proportional to quantity of chunks of the change log, it lets consumers skip
+    rebuilding of data, which doesn't depend on changed parts.
+    @param v Version of the automation.
+    @return Combination of @ref DirtyFlags values or std::nullopt, if the change log doesn't cover version @a v. */
+    [[nodiscard]] std::optional<unsigned> getDirtySince(uint64_t v) const noexcept;
+
+    /*! Closes the current batch of changes, consumers should apply the whole batches of changes.
+    @return Version of the automation. */
+    uint64_t commitChanges() noexcept;
+
+    /*! Returns version of the automation at the last call of @ref commitChanges method.
+    @return Committed version. */
+    [[nodiscard]] inline uint64_t getCommittedVersion() const noexcept {
+      return _journal.committedVersion();
+    }
+
+    friend class AutomationBuilder;
+    friend class CompiledNet;
+    friend std::ostream& operator<<(std::ostream& o, const Automation& a);
+
   protected:
 
+    /*! Type of links dictionary. */
+    using Links = std::pmr::map<std::string, unsigned>;
+
     /*! Internal template class storing automation components and their relations.
     @details This class contains one object of automation component (state or event) and dictionaries of its input and
-    output links to other components. */
+    output links to other components. The class is allocator-aware, so the dictionary containing the object passes its
+    memory resource to the links dictionaries. */
     template<class T>
     class ComponentWithLinks {
     public:
 
+      /*! Type of allocator used by the links dictionaries. */
+      using allocator_type = std::pmr::polymorphic_allocator<char>;
+
       /*! Constructs a @ref ComponentWithLinks object by copying of other @ref ComponentWithLinks object. */
       ComponentWithLinks(const ComponentWithLinks&) = default;
 
       /*! Constructs a @ref ComponentWithLinks object by moving of other @ref ComponentWithLinks object. */
       ComponentWithLinks(ComponentWithLinks&&) noexcept = default;
 
+      /*! Constructs a @ref ComponentWithLinks object by copying of other @ref ComponentWithLinks object with allocator.
+      @param o Object for copying.
+      @param a Allocator of links dictionaries. */
+      ComponentWithLinks(const ComponentWithLinks& o, const allocator_type& a) :
+        Component(o.Component), Inputs(o.Inputs, a), Outputs(o.Outputs, a) {}
+
+      /*! Constructs a @ref ComponentWithLinks object by moving of other @ref ComponentWithLinks object with allocator.
+      @param o Object for moving.
+      @param a Allocator of links dictionaries. */
+      ComponentWithLinks(ComponentWithLinks&& o, const allocator_type& a) :
+        Component(std::move(o.Component)), Inputs(std::move(o.Inputs), a), Outputs(std::move(o.Outputs), a) {}
+
       /*! Assigns new value of a @ref ComponentWithLinks object by copying of other @ref ComponentWithLinks object. */
       ComponentWithLinks& operator=(const ComponentWithLinks&) = default;
 
@@ -307,16 +447,19 @@ namespace des {
       ComponentWithLinks& operator=(ComponentWithLinks&&) noexcept = default;
 
       /*! Constructs a @ref ComponentWithLinks object with empty links dictionaries by copying of specified component.
-      @param c Component for store. */
-      explicit ComponentWithLinks(const T& c) : Component(c), Inputs(), Outputs() {}
+      @param c Component for store.
+      @param a Allocator of links dictionaries. */
+      explicit ComponentWithLinks(const T& c, const allocator_type& a = {}) : Component(c), Inputs(a), Outputs(a) {}
 
       /*! Constructs a @ref ComponentWithLinks object with empty links dictionaries by moving of specified component.
-      @param c Component for store (move semantic). */
-      explicit ComponentWithLinks(T&& c) : Component(std::move(c)), Inputs(), Outputs() {}
+      @param c Component for store (move semantic).
+      @param a Allocator of links dictionaries. */
+      explicit ComponentWithLinks(T&& c, const allocator_type& a = {}) :
+        Component(std::move(c)), Inputs(a), Outputs(a) {}
 
-      T Component;                             ///< Main component.
-      std::map<std::string, unsigned> Inputs;  ///< Input link dictionary of component.
-      std::map<std::string, unsigned> Outputs; ///< Output link dictionary of component.
+      T Component;   ///< Main component.
+      Links Inputs;  ///< Input link dictionary of component.
+      Links Outputs; ///< Output link dictionary of component.
 
     }; // ComponentWithLinks class
 
@@ -327,8 +470,24 @@ namespace des {
     @return Result of the event check. */
     [[nodiscard]] bool checkMacroEvent(const Event& e) const noexcept;
 
-    std::map<std::string, ComponentWithLinks<State>> _states; ///< States dictionary of automation.
-    std::map<std::string, ComponentWithLinks<Event>> _events; ///< Events dictionary of automation.
+    /*! Counts change and adds it into the change log, if the log is enabled.
+    @param k Kind of the change.
+    @param s Name of state.
+    @param e Name of event.
+    @param v Activity tokens or multiplicity. */
+    void record(ChangeKind k, const std::string& s, const std::string& e, unsigned v);
+
+    /*! Copies states and events, which are changeable by references of other automation, and fingerprints them.
+    @details The copy of the automation owns these states and events, so they aren't detached in the copy.
+    @param a Original automation. */
+    void ownDetached(const Automation& a);
+
+    SharedDictionary<ComponentWithLinks<State>> _states; ///< States dictionary of automation.
+    SharedDictionary<ComponentWithLinks<Event>> _events; ///< Events dictionary of automation.
+    Fingerprint _fingerprint;                            ///< Fingerprint without detached states and events.
+    SharedDictionary<bool> _detached_states;             ///< States changeable by references, not fingerprinted.
+    SharedDictionary<bool> _detached_events;             ///< Events changeable by references, not fingerprinted.
+    ChangeJournal _journal;                              ///< Change counter and log.
 
   }; // Automation class
 
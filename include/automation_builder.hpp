@@ -0,0 +1,144 @@
+/*! @file automation_builder.hpp
+@ref des::AutomationBuilder class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef AUTOMATION_BUILDER_HPP
+#define AUTOMATION_BUILDER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "automation.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Class of a bulk constructor of @ref Automation objects.
+  @details This class collects states, events and links without any checks and creates the automation by
+  @ref build method, which validates all names and references once and fills dictionaries of the automation in one
+  pass with insertion of sorted names. States and events get indexes in order of addition, links can refer to them by
+  these indexes or by names. Parallel links are merged with sum of multiplicities as parallel arcs of Petri net, links
+  with zero total multiplicity are dropped. The class is intended for generated and imported nets, where per-call
+  checks of @ref Automation methods dominate construction time. */
+  class AutomationBuilder {
+  public:
+
+    /*! Constructs an empty @ref AutomationBuilder object. */
+    AutomationBuilder() = default;
+
+    /*! Reserves memory for components and links.
+    @param s Quantity of states.
+    @param e Quantity of events.
+    @param l Quantity of links. */
+    void reserve(size_t s, size_t e, size_t l);
+
+    /*! Adds state.
+    @param n Name of state.
+    @param a Quantity of activity tokens.
+    @return Index of the state. */
+    size_t addState(std::string n, unsigned a = 0);
+
+    /*! Adds event.
+    @param n Name of event.
+    @param t Type of event.
+    @return Index of the event. */
+    size_t addEvent(std::string n, EventType t = EventType::controllable);
+
+    /*! Adds event with masked event list or mapping rules.
+    @param n Name of event.
+    @param e Event object.
+    @return Index of the event. */
+    size_t addEvent(std::string n, Event e);
+
+    /*! Adds link from state to event by indexes.
+    @param s Index of state.
+    @param e Index of event.
+    @param m Multiplicity of link. */
+    void addLinkFromStateToEvent(size_t s, size_t e, unsigned m = 1);
+
+    /*! Adds link from event to state by indexes.
+    @param e Index of event.
+    @param s Index of state.
+    @param m Multiplicity of link. */
+    void addLinkFromEventToState(size_t e, size_t s, unsigned m = 1);
+
+    /*! Adds link from state to event by names.
+    @param s Name of state.
+    @param e Name of event.
+    @param m Multiplicity of link. */
+    void addLinkFromStateToEvent(std::string s, std::string e, unsigned m = 1);
+
+    /*! Adds link from event to state by names.
+    @param e Name of event.
+    @param s Name of state.
+    @param m Multiplicity of link. */
+    void addLinkFromEventToState(std::string e, std::string s, unsigned m = 1);
+
+    /*! Returns quantity of added states.
+    @return Quantity of states. */
+    [[nodiscard]] inline size_t getStateQuantity() const noexcept {
+      return _states.size();
+    }
+
+    /*! Returns quantity of added events.
+    @return Quantity of events. */
+    [[nodiscard]] inline size_t getEventQuantity() const noexcept {
+      return _events.size();
+    }
+
+    /*! Returns quantity of added links.
+    @return Quantity of links by indexes and by names. */
+    [[nodiscard]] inline size_t getLinkQuantity() const noexcept {
+      return _inputs.size() + _outputs.size() + _named_links.size();
+    }
+
+    /*! Creates automation and clears the builder.
+    @details Names are checked by @ref checkNameString function, duplicates are found among sorted names, names of
+    links are resolved by hash tables. Sorting is skipped, when components are added in order of names. Content of
+    the builder is unspecified after exception.
+    @param r Memory resource of the automation, it must outlive the automation.
+    @return Automation object.
+    @throw std::invalid_argument Invalid or repeated name, link to nonexistent state or event, or total multiplicity
+    of parallel links exceeding UINT_MAX.
+    @throw std::runtime_error Invalid masked events list of macro event. */
+    [[nodiscard]] Automation build(std::pmr::memory_resource* r = std::pmr::get_default_resource());
+
+  private:
+
+    /*! Structure of added state or event. */
+    template<class T>
+    struct Component {
+      std::string Name; ///< Name.
+      T Value;          ///< State or event.
+    };
+
+    /*! Structure of link by indexes. */
+    struct Link {
+      size_t State;          ///< Index of state.
+      size_t Event;          ///< Index of event.
+      uint64_t Multiplicity; ///< Multiplicity, it's wider for sums of parallel links.
+    };
+
+    /*! Structure of link by names. */
+    struct NamedLink {
+      std::string State;     ///< Name of state.
+      std::string Event;     ///< Name of event.
+      unsigned Multiplicity; ///< Multiplicity.
+      bool Input;            ///< Link from state to event.
+    };
+
+    std::vector<Component<State>> _states; ///< Added states.
+    std::vector<Component<Event>> _events; ///< Added events.
+    std::vector<Link> _inputs;             ///< Links from states to events by indexes.
+    std::vector<Link> _outputs;            ///< Links from events to states by indexes.
+    std::vector<NamedLink> _named_links;   ///< Links by names.
+
+  }; // AutomationBuilder class
+
+} // namespace
+
+
+#endif // AUTOMATION_BUILDER_HPP
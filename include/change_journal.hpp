@@ -0,0 +1,190 @@
+/*! @file change_journal.hpp
+@ref des::ChangeJournal class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef CHANGE_JOURNAL_HPP
+#define CHANGE_JOURNAL_HPP
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Enumeration of kinds of automation changes. */
+  enum class ChangeKind {
+    addState,      ///< State is added.
+    removeState,   ///< State without links is removed, its links are removed by preceding changes.
+    changeState,   ///< Activity tokens of state are changed or state is replaced or returned for change.
+    addEvent,      ///< Event is added.
+    removeEvent,   ///< Event without links is removed, its links are removed by preceding changes.
+    changeEvent,   ///< Event is replaced or returned for change.
+    setInputLink,  ///< Link from state to event is set.
+    setOutputLink  ///< Link from event to state is set.
+  };
+
+  /*! Structure of a record of automation change. */
+  struct Change {
+    ChangeKind Kind;      ///< Kind of the change.
+    std::string State;    ///< Name of changed or linked state, empty string for changes of events.
+    std::string Event;    ///< Name of changed or linked event, empty string for changes of states.
+    unsigned Value = 0;   ///< Activity tokens, multiplicity of link or @ref EventType of event after the change.
+    uint64_t Version = 0; ///< Version of the automation after the change.
+    bool Commit = false;  ///< True for the last change of a committed batch.
+  };
+
+  /*! Enumeration of flags of changed parts of automation. */
+  enum DirtyFlags : unsigned {
+    dirtyStates = 1,  ///< States are added or removed.
+    dirtyEvents = 2,  ///< Events are added or removed.
+    dirtyLinks = 4,   ///< Links are set.
+    dirtyMarking = 8, ///< Activity tokens of states are changed, states are added or removed.
+    dirtyTypes = 16   ///< Events are replaced or returned for change.
+  };
+
+  /*! Returns flags of parts of automation changed by a change of specified kind.
+  @param k Kind of the change.
+  @return Combination of @ref DirtyFlags values. */
+  [[nodiscard]] unsigned dirtyFlags(ChangeKind k) noexcept;
+
+
+  /*! Class of a journal of automation changes.
+  @details This class counts changes and, if it's enabled, records them as compact records of 12 bytes: a kind, a
+  value and lengths and offset of names stored in a common buffer. Records are kept in chunks linked from the last
+  chunk to the first one. Copies of the journal share its chunks, a journal appends records to its last chunk, if the
+  chunk isn't shared, and starts a new chunk otherwise, so copies of an automation record their changes independently.
+  Each chunk keeps flags of all its changes (see @ref DirtyFlags), so a query of changed parts skips whole chunks.
+  Changes are grouped into batches by @ref commit calls, consumers can apply whole batches only. */
+  class ChangeJournal {
+  public:
+
+    /*! Constructs a disabled @ref ChangeJournal object.
+    @param r Memory resource of chunks. */
+    explicit ChangeJournal(std::pmr::memory_resource* r = std::pmr::get_default_resource()) noexcept;
+
+    /*! Constructs a @ref ChangeJournal object sharing chunks of other @ref ChangeJournal object. */
+    ChangeJournal(const ChangeJournal&) = default;
+
+    /*! Constructs a @ref ChangeJournal object sharing chunks of other @ref ChangeJournal object.
+    @param j Object for copying.
+    @param r Memory resource of new chunks. */
+    ChangeJournal(const ChangeJournal& j, std::pmr::memory_resource* r) noexcept;
+
+    /*! Constructs a @ref ChangeJournal object by moving of other @ref ChangeJournal object. */
+    ChangeJournal(ChangeJournal&&) noexcept = default;
+
+    /*! Assigns a @ref ChangeJournal object sharing chunks of other @ref ChangeJournal object. */
+    ChangeJournal& operator=(const ChangeJournal&) = default;
+
+    /*! Assigns a @ref ChangeJournal object by moving of other @ref ChangeJournal object. */
+    ChangeJournal& operator=(ChangeJournal&&) noexcept = default;
+
+    /*! Returns quantity of counted changes.
+    @return Version of the automation. */
+    [[nodiscard]] inline uint64_t version() const noexcept {
+      return _version;
+    }
+
+    /*! Returns version of the last commit.
+    @return Version of the automation after the last committed batch. */
+    [[nodiscard]] inline uint64_t committedVersion() const noexcept {
+      return _committed;
+    }
+
+    /*! Returns version, from which changes are recorded.
+    @return The first known version or std::nullopt for the disabled journal. */
+    [[nodiscard]] std::optional<uint64_t> firstVersion() const noexcept;
+
+    /*! Returns true for the journal recording changes.
+    @return State of the journal. */
+    [[nodiscard]] inline bool enabled() const noexcept {
+      return _last != nullptr;
+    }
+
+    /*! Starts recording of changes, nothing happens, if the journal is enabled already. */
+    void enable();
+
+    /*! Stops recording of changes and releases chunks, which aren't shared. */
+    void disable() noexcept;
+
+    /*! Counts a change and records it, if the journal is enabled.
+    @param k Kind of the change.
+    @param s Name of state or empty string.
+    @param e Name of event or empty string.
+    @param v Activity tokens, multiplicity or event type. */
+    void record(ChangeKind k, const std::string& s, const std::string& e, unsigned v);
+
+    /*! Closes the current batch of changes.
+    @return Committed version. */
+    uint64_t commit() noexcept;
+
+    /*! Returns recorded changes after specified version.
+    @details This method takes time proportional to quantity of returned changes and quantity of chunks.
+    @param v Version.
+    @return Changes in order of their making or std::nullopt, if the journal doesn't cover version @a v. */
+    [[nodiscard]] std::optional<std::vector<Change>> changesSince(uint64_t v) const;
+
+    /*! Returns recorded changes after the last change of other journal.
+    @param j Journal of a snapshot of the automation.
+    @return Changes in order of their making or std::nullopt, if this journal isn't a continuation of @a j. */
+    [[nodiscard]] std::optional<std::vector<Change>> changesSince(const ChangeJournal& j) const;
+
+    /*! Returns flags of parts of automation changed after specified version.
+    @param v Version.
+    @return Combination of @ref DirtyFlags values or std::nullopt, if the journal doesn't cover version @a v. */
+    [[nodiscard]] std::optional<unsigned> dirtySince(uint64_t v) const noexcept;
+
+    /*! Returns size of memory used by records and names.
+    @return Size in bytes. */
+    [[nodiscard]] size_t memory() const noexcept;
+
+  private:
+
+    /*! Structure of a compact change record. */
+    struct Record {
+      uint32_t Offset = 0;     ///< Offset of the state name in the names buffer, the event name follows it.
+      uint32_t Value = 0;      ///< Activity tokens, multiplicity or event type.
+      uint8_t Kind = 0;        ///< @ref ChangeKind value.
+      uint8_t StateLength = 0; ///< Length of the state name.
+      uint8_t EventLength = 0; ///< Length of the event name.
+      uint8_t Flags = 0;       ///< Flag of the first change of a batch.
+    };
+
+    /*! Structure of a chunk of records, chunks are linked from the last one to the first one. */
+    struct Chunk {
+      std::pmr::vector<Record> Records; ///< Records.
+      std::pmr::string Names;           ///< Names of states and events of records.
+      uint64_t First = 0;               ///< Version before the first record.
+      unsigned Dirty = 0;               ///< Flags of all records.
+      std::shared_ptr<Chunk> Previous;  ///< Previous chunk or null pointer for the first chunk.
+
+      /*! Constructs an empty chunk. */
+      Chunk(uint64_t f, std::shared_ptr<Chunk> p, std::pmr::memory_resource* r);
+
+      /*! Destroys chunks, which aren't shared, in a loop instead of recursion. */
+      ~Chunk();
+    };
+
+    /*! Returns the chunk containing the record after version @a v or null pointer. */
+    [[nodiscard]] const Chunk* locate(uint64_t v) const noexcept;
+
+    /*! Appends changes after version @a v from the chunk list. */
+    void collect(uint64_t v, std::vector<Change>& c) const;
+
+    std::pmr::memory_resource* _resource; ///< Memory resource of chunks.
+    uint64_t _version = 0;                ///< Quantity of changes.
+    uint64_t _committed = 0;              ///< Version of the last commit.
+    std::shared_ptr<Chunk> _last;         ///< The last chunk or null pointer for the disabled journal.
+
+  }; // ChangeJournal class
+
+} // namespace
+
+
+#endif // CHANGE_JOURNAL_HPP
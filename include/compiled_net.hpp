@@ -0,0 +1,197 @@
+/*! @file compiled_net.hpp
+@ref des::CompiledNet class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef COMPILED_NET_HPP
+#define COMPILED_NET_HPP
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "automation.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  class MappedNet;
+
+  /*! Token quantity of an unbounded state (omega) in a coverability marking. */
+  const unsigned omega = std::numeric_limits<unsigned>::max();
+
+  /*! Marking of a compiled net.
+  @details Marking contains token quantities of all states ordered by state index of @ref CompiledNet. */
+  using Marking = std::vector<unsigned>;
+
+  /*! Structure of a weighted link of a compiled net.
+  @details This structure contains index of linked state or event and multiplicity of the link. */
+  struct Arc {
+    unsigned Index = 0;        ///< Index of linked state or event.
+    unsigned Multiplicity = 0; ///< Multiplicity of link.
+  };
+
+  /*! Structure of a contiguous range of @ref Arc objects. */
+  struct ArcRange {
+    const Arc* First = nullptr; ///< Pointer to the first link.
+    const Arc* Last = nullptr;  ///< Pointer past the last link.
+
+    /*! Returns pointer to the first link of the range. */
+    [[nodiscard]] inline const Arc* begin() const noexcept {
+      return First;
+    }
+
+    /*! Returns pointer past the last link of the range. */
+    [[nodiscard]] inline const Arc* end() const noexcept {
+      return Last;
+    }
+
+    /*! Returns quantity of links in the range. */
+    [[nodiscard]] inline size_t size() const noexcept {
+      return static_cast<size_t>(Last - First);
+    }
+
+    /*! Returns true for the range without links. */
+    [[nodiscard]] inline bool empty() const noexcept {
+      return First == Last;
+    }
+  };
+
+  /*! Class of an immutable index-based view of an automation.
+  @details This class contains states and events of an @ref Automation object numbered in order of their names, initial
+  marking and input and output links of events stored in contiguous arrays. Names are resolved only once at
+  construction, so the enabling and firing checks don't perform any dictionary lookups or allocations. An event without
+  input links is never ready, as in @ref Automation::getReadyEvents. The state with @ref omega tokens is unbounded: it
+  satisfies any input link and keeps @ref omega tokens after firing. Input links are also indexed by states, so events
+  consuming from a changed state are found without search. */
+  class CompiledNet {
+  public:
+
+    /*! Constructs a @ref CompiledNet object from specified automation.
+    @param a Automation for compilation. */
+    explicit CompiledNet(const Automation& a);
+
+    /*! Constructs a @ref CompiledNet object from binary net by copying of its link arrays.
+    @param m View of binary net. */
+    explicit CompiledNet(const MappedNet& m);
+
+    /*! Returns quantity of states in the net.
+    @return Quantity of states. */
+    [[nodiscard]] inline size_t getStateQuantity() const noexcept {
+      return _state_names.size();
+    }
+
+    /*! Returns quantity of events in the net.
+    @return Quantity of events. */
+    [[nodiscard]] inline size_t getEventQuantity() const noexcept {
+      return _event_names.size();
+    }
+
+    /*! Returns name of state by index.
+    @param i Index of state.
+    @return Name of the state.
+    @throw std::out_of_range Invalid index of state. */
+    [[nodiscard]] inline const std::string& getStateName(size_t i) const {
+      return _state_names.at(i);
+    }
+
+    /*! Returns name of event by index.
+    @param i Index of event.
+    @return Name of the event.
+    @throw std::out_of_range Invalid index of event. */
+    [[nodiscard]] inline const std::string& getEventName(size_t i) const {
+      return _event_names.at(i);
+    }
+
+    /*! Returns index of state by name.
+    @param n Name of state.
+    @return Index of the state.
+    @throw std::out_of_range The net hasn't a state with specified name. */
+    [[nodiscard]] size_t getStateIndex(const std::string& n) const;
+
+    /*! Returns index of event by name.
+    @param n Name of event.
+    @return Index of the event.
+    @throw std::out_of_range The net hasn't an event with specified name. */
+    [[nodiscard]] size_t getEventIndex(const std::string& n) const;
+
+    /*! Returns type of event by index.
+    @param i Index of event.
+    @return Type of the event.
+    @throw std::out_of_range Invalid index of event. */
+    [[nodiscard]] inline EventType getType(size_t i) const {
+      return _event_types.at(i);
+    }
+
+    /*! Returns initial marking of the net.
+    @return Token quantities of states at construction time. */
+    [[nodiscard]] inline const Marking& getInitialMarking() const noexcept {
+      return _initial;
+    }
+
+    /*! Returns input links (from states) of event by index.
+    @param t Index of event.
+    @return Range of links, @ref Arc::Index is a state index. */
+    [[nodiscard]] inline ArcRange getEventInputs(size_t t) const noexcept {
+      return { _inputs.data() + _input_offsets[t], _inputs.data() + _input_offsets[t + 1] };
+    }
+
+    /*! Returns output links (to states) of event by index.
+    @param t Index of event.
+    @return Range of links, @ref Arc::Index is a state index. */
+    [[nodiscard]] inline ArcRange getEventOutputs(size_t t) const noexcept {
+      return { _outputs.data() + _output_offsets[t], _outputs.data() + _output_offsets[t + 1] };
+    }
+
+    /*! Returns input links of events from state by index.
+    @param s Index of state.
+    @return Range of links in order of events, @ref Arc::Index is an event index. */
+    [[nodiscard]] inline ArcRange getStateConsumers(size_t s) const noexcept {
+      return { _consumers.data() + _consumer_offsets[s], _consumers.data() + _consumer_offsets[s + 1] };
+    }
+
+    /*! Returns quantity of unsatisfied input links of event in specified marking.
+    @details An event without input links has one unsatisfied link, so the event is ready, if and only if the quantity
+    is zero. Simulators keep these quantities and update them by @ref getStateConsumers links of changed states.
+    @param m Marking of the net.
+    @param t Index of event.
+    @return Quantity of links. */
+    [[nodiscard]] unsigned getMissingInputs(const Marking& m, size_t t) const noexcept;
+
+    /*! Returns true for event ready to fire in specified marking.
+    @param m Marking of the net.
+    @param t Index of event.
+    @return Result of the event check. */
+    [[nodiscard]] bool isReady(const Marking& m, size_t t) const noexcept;
+
+    /*! Fires event in specified marking.
+    @details This method writes the marking reached by firing of the event @a t into the marking @a r. The event must be
+    ready in the marking @a m. Token quantity, that can't be represented, is saturated to value less then @ref omega.
+    @param m Marking of the net.
+    @param t Index of ready event.
+    @param r Resulting marking. */
+    void fire(const Marking& m, size_t t, Marking& r) const;
+
+  private:
+
+    /*! Builds input links of events indexed by states. */
+    void indexConsumers();
+
+    std::vector<std::string> _state_names; ///< State names ordered by index.
+    std::vector<std::string> _event_names; ///< Event names ordered by index.
+    std::vector<EventType> _event_types;   ///< Event types ordered by index.
+    Marking _initial;                      ///< Initial marking.
+    std::vector<size_t> _input_offsets;    ///< Offsets of event input links.
+    std::vector<Arc> _inputs;              ///< Input links of all events.
+    std::vector<size_t> _output_offsets;   ///< Offsets of event output links.
+    std::vector<Arc> _outputs;             ///< Output links of all events.
+    std::vector<size_t> _consumer_offsets; ///< Offsets of state links to events.
+    std::vector<Arc> _consumers;           ///< Input links of all events ordered by states.
+
+  }; // CompiledNet class
+
+} // namespace
+
+
+#endif // COMPILED_NET_HPP
@@ -8,7 +8,8 @@ DES model components classes header file.
 
 #include <exception>
 #include <list>
-#include <regex>
+#include <memory>
+#include <stdexcept>
 #include <string>
 
 
@@ -68,6 +69,63 @@ namespace des {
   @return Result of the comparison. */
   bool operator==(const BehaviorAttribute& l, const BehaviorAttribute& r) noexcept;
 
+  /*! Template class of lazily allocated storage of rarely used (cold) data.
+  @details Object of this class holds only a pointer, the value is allocated at the first access for change. So objects
+  without such data stay small and the frequently used (hot) fields of neighbouring objects share cache lines. Absent
+  value is equal to default value of type @a T, copies of the storage are deep. */
+  template<class T>
+  class ColdStorage {
+  public:
+
+    /*! Constructs an empty @ref ColdStorage object. */
+    ColdStorage() noexcept = default;
+
+    /*! Constructs a @ref ColdStorage object by copying of value of other @ref ColdStorage object. */
+    ColdStorage(const ColdStorage& o) : _value(o._value ? std::make_unique<T>(*o._value) : nullptr) {}
+
+    /*! Constructs a @ref ColdStorage object by moving of other @ref ColdStorage object. */
+    ColdStorage(ColdStorage&&) noexcept = default;
+
+    /*! Assigns copy of value of other @ref ColdStorage object. */
+    ColdStorage& operator=(const ColdStorage& o) {
+      if (this != &o) {
+        _value = o._value ? std::make_unique<T>(*o._value) : nullptr;
+      }
+      return *this;
+    }
+
+    /*! Assigns new value by moving of other @ref ColdStorage object. */
+    ColdStorage& operator=(ColdStorage&&) noexcept = default;
+
+    /*! Returns stored value, the value is allocated at the first call.
+    @return Reference to the value. */
+    inline T& get() {
+      if (!_value) {
+        _value = std::make_unique<T>();
+      }
+      return *_value;
+    }
+
+    /*! Returns pointer to stored value without allocation.
+    @return Pointer to the value or null pointer for the value that wasn't allocated. */
+    [[nodiscard]] inline const T* find() const noexcept {
+      return _value.get();
+    }
+
+    /*! Returns true for equal values, absent value is equal to default value.
+    @param o @ref ColdStorage object for comparison.
+    @return Result of the comparison. */
+    bool operator==(const ColdStorage& o) const noexcept {
+      static const T empty{};
+      return (_value ? *_value : empty) == (o._value ? *o._value : empty);
+    }
+
+  private:
+
+    std::unique_ptr<T> _value; ///< Stored value or null pointer.
+
+  }; // ColdStorage class
+
   /*! Returns true for correct name string.
   @details This function checks correctness of specified name string and returns its result. Correct name string has
   length less then @ref max_name_length, starts with Latin letter and contains only Latin letters, digits, underscores
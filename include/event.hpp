@@ -27,7 +27,8 @@ namespace des {
   /*! Class of a DES event corresponding a Petri net transition.
   @details This class contains event type, view properties, list of behavior attributes, list of masked event names,
   list of mapping rules for masked events. Only macro event can have non-empty lists of masked event names or mapping
-  rules. */
+  rules. Everything except the type is kept in @ref ColdStorage, which is allocated at the first change, so the event
+  itself takes two words. */
   class Event {
   public:
 
@@ -55,16 +56,16 @@ namespace des {
       return _type;
     }
 
-    /*! Returns view properties of event.
+    /*! Returns view properties of event, they are allocated at the first call.
     @return Reference to the event view properties. */
-    inline ViewProperties& viewProperties() noexcept {
-      return _properties;
+    inline ViewProperties& viewProperties() {
+      return _metadata.get().Properties;
     }
 
-    /*! Returns behavior attribute list of the event.
+    /*! Returns behavior attribute list of the event, it's allocated at the first call.
     @return Reference to the event behavior attribute list. */
-    inline std::list<BehaviorAttribute>& behaviorAttributes() noexcept {
-      return _attributes;
+    inline std::list<BehaviorAttribute>& behaviorAttributes() {
+      return _metadata.get().Attributes;
     }
 
     /*! Returns copy of masked event name list from the macro event.
@@ -107,11 +108,19 @@ namespace des {
 
   protected:
 
+    /*! Structure of rarely used data of event. */
+    struct Metadata {
+      ViewProperties Properties;                             ///< View properties of event.
+      std::list<BehaviorAttribute> Attributes;               ///< Behavior attribute list of event.
+      std::list<std::string> MaskedEvents;                   ///< Masked event name list (for macro event).
+      std::list<BehaviorAttributeRestriction> MappingRules;  ///< Mapping rule list (for macro event).
+
+      /*! Returns true for equal @ref Metadata object. */
+      bool operator==(const Metadata& m) const noexcept;
+    };
+
     EventType _type;                                        ///< Type of event.
-    ViewProperties _properties;                             ///< View properties of event.
-    std::list<BehaviorAttribute> _attributes;               ///< Behavior attribute list of event.
-    std::list<std::string> _masked_events;                  ///< Masked event name list (for macro event).
-    std::list<BehaviorAttributeRestriction> _mapping_rules; ///< Mapping rule list (for macro event).
+    ColdStorage<Metadata> _metadata;                        ///< Rarely used data of event.
 
   }; // Event class
 
@@ -0,0 +1,74 @@
+/*! @file external_bfs.hpp
+@ref des::ExternalExplorer class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef EXTERNAL_BFS_HPP
+#define EXTERNAL_BFS_HPP
+
+#include <string>
+
+#include "analysis_control.hpp"
+#include "compiled_net.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Structure of options for disk-backed exploration.
+  @details This structure contains directory for temporary run files, memory budget for markings kept in memory,
+  limits of exploration and progress reporting settings. Empty directory means system temporary directory. Zero
+  @ref MaxStates means no limit. */
+  struct ExternalExplorerOptions {
+    std::string Directory = "";                          ///< Directory for temporary run files.
+    size_t MemoryBudget = 64 << 20;                      ///< Memory budget for resident markings in bytes.
+    size_t MaxStates = 0;                                ///< Limit of explored markings.
+    unsigned TokenBound = omega - 1;                     ///< Limit of token quantity in one state.
+    ProgressCallback Progress = nullptr;                 ///< Progress callback or empty function.
+    std::chrono::milliseconds ProgressInterval{ 1000 };  ///< Min interval between progress callback calls.
+  };
+
+  /*! Structure of disk-backed exploration result.
+  @details This structure contains statistics of explored reachability set. @ref Complete is false, if exploration was
+  stopped by a limit of @ref ExternalExplorerOptions, in this case the other fields describe the explored part. */
+  struct ExternalExplorerResult {
+    bool Complete = false;    ///< True for exhaustively explored reachability set.
+    size_t States = 0;        ///< Quantity of distinct reachable markings.
+    size_t Transitions = 0;   ///< Quantity of fired events (edges of reachability graph).
+    size_t Layers = 0;        ///< Quantity of breadth-first layers (depth of reachability graph).
+    size_t Deadlocks = 0;     ///< Quantity of markings without ready events.
+    Marking Bounds = {};      ///< Max token quantity of each state over explored markings.
+    size_t BytesWritten = 0;  ///< Quantity of bytes written into run files.
+    size_t Runs = 0;          ///< Quantity of sorted run files.
+  };
+
+  /*! Class of a breadth-first explorer of reachability set with delayed duplicate detection.
+  @details This class explores the reachability set of a @ref CompiledNet layer by layer. Successors of a layer are
+  collected in memory up to the memory budget, sorted and written into run files. At the end of a layer the runs are
+  merged with removing of duplicates and subtracted from the sorted file of visited markings in one sequential pass, so
+  only buffers stay in memory and the size of reachability set is limited by disk space. The explorer doesn't
+  accelerate unbounded nets, their exploration stops at @ref ExternalExplorerOptions::TokenBound. */
+  class ExternalExplorer {
+  public:
+
+    /*! Constructs a @ref ExternalExplorer object for specified net.
+    @param n Compiled net, it must outlive the explorer.
+    @param o Options of exploration. */
+    explicit ExternalExplorer(const CompiledNet& n, const ExternalExplorerOptions& o = {});
+
+    /*! Explores the reachability set from the initial marking.
+    @return Result of the exploration.
+    @throw std::runtime_error Run file can't be created, written or read. */
+    ExternalExplorerResult run();
+
+  private:
+
+    const CompiledNet& _net;           ///< Explored net.
+    ExternalExplorerOptions _options;  ///< Options of exploration.
+
+  }; // ExternalExplorer class
+
+} // namespace
+
+
+#endif // EXTERNAL_BFS_HPP
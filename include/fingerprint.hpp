@@ -0,0 +1,98 @@
+/*! @file fingerprint.hpp
+Structural fingerprint of Petri nets header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef FINGERPRINT_HPP
+#define FINGERPRINT_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "event.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Structure of a 128-bit structural fingerprint of a net.
+  @details The fingerprint of a net is the sum of fingerprints of its states (names and activity tokens), events (names
+  and types) and links (names of linked components, direction and multiplicity), each half is summed modulo 2^64. The
+  sum doesn't depend on order of components, so the fingerprint is updated in constant time after each change by
+  subtraction of the old fingerprint of the changed component and addition of the new one. Equal nets have equal
+  fingerprints. The halves are computed by unrelated hashes with different primes and final mixers (FNV-1a and a
+  rotate-multiply hash), so a collision of one half doesn't imply a collision of the other. The fingerprint detects
+  accidental changes, but it isn't cryptographic and can be forged. View properties, behavior attributes and masked
+  events aren't covered. */
+  struct Fingerprint {
+    uint64_t High = 0; ///< High half.
+    uint64_t Low = 0;  ///< Low half.
+
+    /*! Adds fingerprint of a component.
+    @param f Fingerprint of the component.
+    @return Reference to this fingerprint. */
+    inline Fingerprint& operator+=(const Fingerprint& f) noexcept {
+      High += f.High;
+      Low += f.Low;
+      return *this;
+    }
+
+    /*! Subtracts fingerprint of a component.
+    @param f Fingerprint of the component.
+    @return Reference to this fingerprint. */
+    inline Fingerprint& operator-=(const Fingerprint& f) noexcept {
+      High -= f.High;
+      Low -= f.Low;
+      return *this;
+    }
+
+    /*! Returns true for equal fingerprints.
+    @param f Fingerprint for comparison.
+    @return Result of the comparison. */
+    [[nodiscard]] inline bool operator==(const Fingerprint& f) const noexcept {
+      return High == f.High && Low == f.Low;
+    }
+
+    /*! Returns true for different fingerprints.
+    @param f Fingerprint for comparison.
+    @return Result of the comparison. */
+    [[nodiscard]] inline bool operator!=(const Fingerprint& f) const noexcept {
+      return !(*this == f);
+    }
+
+    /*! Returns true for fingerprint less than other one, it orders fingerprints in dictionaries.
+    @param f Fingerprint for comparison.
+    @return Result of the comparison. */
+    [[nodiscard]] inline bool operator<(const Fingerprint& f) const noexcept {
+      return High != f.High ? High < f.High : Low < f.Low;
+    }
+
+    /*! Returns fingerprint as 32 hexadecimal digits.
+    @return String with the fingerprint. */
+    [[nodiscard]] std::string toString() const;
+  };
+
+  /*! Returns fingerprint of a state.
+  @param n Name of the state.
+  @param a Quantity of activity tokens.
+  @return Fingerprint. */
+  [[nodiscard]] Fingerprint fingerprintState(const std::string& n, unsigned a) noexcept;
+
+  /*! Returns fingerprint of an event.
+  @param n Name of the event.
+  @param t Type of the event.
+  @return Fingerprint. */
+  [[nodiscard]] Fingerprint fingerprintEvent(const std::string& n, EventType t) noexcept;
+
+  /*! Returns fingerprint of a link.
+  @param s Name of the state.
+  @param e Name of the event.
+  @param i True for link from the state to the event, false for link from the event to the state.
+  @param m Multiplicity of the link.
+  @return Fingerprint. */
+  [[nodiscard]] Fingerprint fingerprintLink(const std::string& s, const std::string& e, bool i, unsigned m) noexcept;
+
+} // namespace
+
+
+#endif // FINGERPRINT_HPP
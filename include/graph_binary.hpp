@@ -0,0 +1,215 @@
+/*! @file graph_binary.hpp
+Binary format of reachability graphs and @ref des::MappedGraph class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef GRAPH_BINARY_HPP
+#define GRAPH_BINARY_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "compiled_net.hpp"
+#include "net_binary.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Version of binary graph format written by @ref writeBinaryGraph. */
+  const uint32_t binary_graph_version = 1;
+
+  /*! Quantity of nodes in a block of binary graph, index sections keep offsets of blocks. */
+  const uint32_t binary_graph_block = 64;
+
+  /*! Default limit of nodes written by @ref writeBinaryGraph. */
+  const size_t default_graph_states = size_t(1) << 24;
+
+  /*! Structure of the header of binary graph.
+  @details The header is followed by sections at 8-byte aligned offsets: the string table, @ref BinaryString references
+  to state and event names, the edge index and edge data, the marking index and marking data. Nodes are numbered in
+  breadth-first order from the initial marking 0. Edge data contains a record for each node: quantity of its edges
+  and, for each edge, the event index as difference from the previous edge event (edges are ordered by events) and
+  the target number as zigzag-coded difference from the node number. Marking data contains a record for each node: the
+  difference between the node number and its parent number shifted left by one bit with the lowest bit set for a full
+  record, quantity of changed states and, for each of them, difference of the state index from the previous one and
+  the token quantity. A full record lists states with tokens, other records list states with token quantities
+  different from the parent marking, a full record is written at least every 16 generations. All numbers of records
+  are LEB128 variable-length integers. An index section keeps offsets of records of each block of
+  @ref binary_graph_block nodes in its data section and the size of the data section at the end. Numbers of the header
+  and index sections have byte order of the writer, which is checked by @ref ByteOrder field. */
+  struct BinaryGraphHeader {
+    char Magic[4] = { 'D', 'E', 'S', 'G' }; ///< Signature of the format.
+    uint32_t Version = binary_graph_version; ///< Version of the format.
+    uint32_t ByteOrder = 0x01020304;        ///< Byte order mark.
+    uint32_t HeaderSize = 0;                ///< Size of the header in bytes.
+    uint64_t FileSize = 0;                  ///< Size of the file in bytes.
+    uint64_t Nodes = 0;                     ///< Quantity of nodes (markings).
+    uint64_t Edges = 0;                     ///< Quantity of edges (fired events).
+    uint64_t Deadlocks = 0;                 ///< Quantity of nodes without ready events.
+    uint32_t States = 0;                    ///< Quantity of states of the net.
+    uint32_t Events = 0;                    ///< Quantity of events of the net.
+    uint32_t Depth = 0;                     ///< Max distance from the initial marking.
+    uint32_t Complete = 0;                  ///< 1 for exhaustively explored graph, 0 for graph stopped by a limit.
+    uint32_t MaxTokens = 0;                 ///< Max token quantity of a state over all markings.
+    uint32_t Reserved = 0;                  ///< Zero.
+    uint64_t Strings = 0;                   ///< Offset of the string table.
+    uint64_t StringBytes = 0;               ///< Size of the string table.
+    uint64_t StateNames = 0;                ///< Offset of state names.
+    uint64_t EventNames = 0;                ///< Offset of event names.
+    uint64_t EdgeIndex = 0;                 ///< Offset of the edge index.
+    uint64_t EdgeData = 0;                  ///< Offset of edge records.
+    uint64_t EdgeBytes = 0;                 ///< Size of edge records.
+    uint64_t MarkingIndex = 0;              ///< Offset of the marking index.
+    uint64_t MarkingData = 0;               ///< Offset of marking records.
+    uint64_t MarkingBytes = 0;              ///< Size of marking records.
+  };
+
+  /*! Structure of binary graph writing options.
+  @details The limit of nodes is required, because markings are kept in memory and nodes are 32-bit numbers: it must
+  be from 1 to UINT32_MAX, the default @ref default_graph_states limit stops exploration of unbounded nets. After the
+  limit new markings aren't added and edges to them are omitted, the header of the graph isn't complete. */
+  struct BinaryGraphOptions {
+    size_t MaxStates = default_graph_states; ///< Limit of nodes.
+  };
+
+  /*! Structure of an edge of binary graph. */
+  struct GraphEdge {
+    uint32_t Event = 0;  ///< Index of the fired event.
+    uint32_t Target = 0; ///< Number of the reached node.
+  };
+
+  /*! Explores reachability graph of the net and writes it in binary format.
+  @details The graph is explored breadth-first with markings kept in memory, the edge and marking records are encoded
+  during exploration, so the written data takes several bytes per edge and per changed state.
+  @param o Output stream opened in binary mode.
+  @param n Compiled net.
+  @param p Options of writing.
+  @return Header of the written graph.
+  @throw std::invalid_argument Zero limit of nodes or the limit exceeding UINT32_MAX.
+  @throw std::length_error Quantity of states, events or name characters exceeds 32-bit numbers.
+  @throw std::runtime_error Writing error. */
+  BinaryGraphHeader writeBinaryGraph(std::ostream& o, const CompiledNet& n, const BinaryGraphOptions& p = {});
+
+  /*! Explores reachability graph of the net and writes it in binary format into file.
+  @param f Path to the file.
+  @param n Compiled net.
+  @param p Options of writing.
+  @return Header of the written graph.
+  @throw std::runtime_error File can't be created or written. */
+  BinaryGraphHeader writeBinaryGraphFile(const std::string& f, const CompiledNet& n, const BinaryGraphOptions& p = {});
+
+  /*! Class of a read-only view of binary graph.
+  @details This class maps a file with binary graph into memory (or reads it, where memory mapping isn't available)
+  and checks the header and index sections once. Records are decoded on demand: edges of a node are found by the index
+  and decoding of less than @ref binary_graph_block records, a marking is restored from the nearest full record of its
+  ancestors. Damaged records are detected during decoding. */
+  class MappedGraph {
+  public:
+
+    /*! Number of absent node. */
+    static const size_t none = UINT32_MAX;
+
+    /*! Maps binary graph file.
+    @param p Path to the file.
+    @throw std::runtime_error File can't be opened or isn't a valid binary graph. */
+    explicit MappedGraph(const std::string& p);
+
+    /*! Constructs a view of binary graph in memory.
+    @param d Pointer to the 8-byte aligned data, it must outlive the view.
+    @param s Size of the data in bytes.
+    @throw std::runtime_error Data isn't a valid binary graph. */
+    MappedGraph(const void* d, size_t s);
+
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+
+    /*! Unmaps the file. */
+    ~MappedGraph();
+
+    /*! Returns the header with statistics of the graph.
+    @return Header. */
+    [[nodiscard]] inline const BinaryGraphHeader& getHeader() const noexcept {
+      return *_header;
+    }
+
+    /*! Returns quantity of nodes.
+    @return Quantity of nodes. */
+    [[nodiscard]] inline size_t getNodeQuantity() const noexcept {
+      return _header->Nodes;
+    }
+
+    /*! Returns quantity of edges.
+    @return Quantity of edges. */
+    [[nodiscard]] inline size_t getEdgeQuantity() const noexcept {
+      return _header->Edges;
+    }
+
+    /*! Returns name of state by index.
+    @param i Index of state.
+    @return Name of the state. */
+    [[nodiscard]] inline std::string_view getStateName(size_t i) const noexcept {
+      return text(_state_names[i]);
+    }
+
+    /*! Returns name of event by index.
+    @param t Index of event.
+    @return Name of the event. */
+    [[nodiscard]] inline std::string_view getEventName(size_t t) const noexcept {
+      return text(_event_names[t]);
+    }
+
+    /*! Decodes edges of node.
+    @param i Number of node.
+    @param e Edges ordered by events.
+    @throw std::runtime_error The record is damaged. */
+    void getEdges(size_t i, std::vector<GraphEdge>& e) const;
+
+    /*! Decodes marking of node.
+    @param i Number of node.
+    @param m Marking.
+    @throw std::runtime_error The record is damaged. */
+    void getMarking(size_t i, Marking& m) const;
+
+    /*! Returns number of parent node, which is the first node reaching the node.
+    @param i Number of node.
+    @return Number of the parent node or @ref none for the initial marking.
+    @throw std::runtime_error The record is damaged. */
+    [[nodiscard]] size_t getParent(size_t i) const;
+
+  private:
+
+    /*! Returns string by reference into the string table. */
+    [[nodiscard]] inline std::string_view text(const BinaryString& s) const noexcept {
+      return { _strings + s.Offset, s.Length };
+    }
+
+    /*! Returns pointer to the record of node in data section by its index. */
+    [[nodiscard]] const uint8_t* locate(size_t i, const uint64_t* index, const uint8_t* data, uint64_t bytes,
+      bool edges) const;
+
+    /*! Checks the header and index sections, sets section pointers.
+    @param s Size of the data in bytes. */
+    void attach(size_t s);
+
+    const char* _data = nullptr;                  ///< Binary graph data.
+    size_t _mapped_size = 0;                      ///< Size of mapped file or zero for data not owned by the view.
+    std::vector<uint64_t> _buffer;                ///< Data read from file, where memory mapping isn't available.
+    const BinaryGraphHeader* _header = nullptr;   ///< Header.
+    const char* _strings = nullptr;               ///< String table.
+    const BinaryString* _state_names = nullptr;   ///< State names.
+    const BinaryString* _event_names = nullptr;   ///< Event names.
+    const uint64_t* _edge_index = nullptr;        ///< Offsets of edge blocks.
+    const uint8_t* _edges = nullptr;              ///< Edge records.
+    const uint64_t* _marking_index = nullptr;     ///< Offsets of marking blocks.
+    const uint8_t* _markings = nullptr;           ///< Marking records.
+
+  }; // MappedGraph class
+
+} // namespace
+
+
+#endif // GRAPH_BINARY_HPP
@@ -0,0 +1,140 @@
+/*! @file graph_export.hpp
+@ref des::GraphExporter class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef GRAPH_EXPORT_HPP
+#define GRAPH_EXPORT_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Enumeration of formats of exported graphs. */
+  enum class GraphFormat {
+    dot,     ///< Graphviz DOT description.
+    graphml, ///< GraphML document.
+    csv      ///< Edge list with "source,target,event" columns.
+  };
+
+  /*! Structure of graph export options.
+  @details Zero value of a limit means no limit. Sampling keeps a node with the specified probability, the decision
+  depends on the node identifier and the seed only, so nothing is stored for it and the same nodes are kept in each
+  run. The root node is always kept. Edges are kept, if both their nodes are kept. */
+  struct GraphExportOptions {
+    GraphFormat Format = GraphFormat::dot; ///< Format of files.
+    size_t MaxNodes = 0;                   ///< Limit of written nodes.
+    size_t MaxEdges = 0;                   ///< Limit of written edges.
+    double Sampling = 1.0;                 ///< Probability of keeping a node.
+    uint64_t Seed = 0;                     ///< Seed of sampling.
+    uint64_t MaxFileSize = 0;              ///< Limit of a file size in bytes, the next file is started after it.
+    bool Markings = true;                  ///< Write markings as labels of nodes.
+  };
+
+  /*! Class of a streaming exporter of a reachability (coverability) graph.
+  @details This class writes nodes and edges into files as soon as they are added, so the graph isn't stored in
+  memory. It's attached to an analysis by @ref AnalysisOptions::Exporter, the analysis adds markings of its tree and
+  edges of fired events, including edges to markings explored earlier. Node identifiers must increase. Output is
+  buffered and written by large blocks. With a file size limit the graph is written into several files: the first one
+  has the specified path, the next ones have the number before the extension ("graph.1.dot", "graph.2.dot" and so on).
+  Each file is a complete document of its format: a GraphML file repeats nodes of earlier files, which are ends of its
+  edges, as nodes without data. An exporter can be used by one analysis at a time. */
+  class GraphExporter {
+  public:
+
+    /*! Opens the first file.
+    @param p Path to the file.
+    @param o Options of export.
+    @throw std::runtime_error The file can't be opened. */
+    explicit GraphExporter(const std::string& p, const GraphExportOptions& o = {});
+
+    GraphExporter(const GraphExporter&) = delete;
+    GraphExporter& operator=(const GraphExporter&) = delete;
+
+    /*! Closes the last file. */
+    ~GraphExporter();
+
+    /*! Adds a node.
+    @param n Identifier of the node.
+    @param m Marking of the node, negative tokens mean unbounded state. */
+    void addNode(uint64_t n, const std::map<std::string, int>& m);
+
+    /*! Adds an edge.
+    @param s Identifier of the source node.
+    @param t Identifier of the target node.
+    @param e Name of the fired event. */
+    void addEdge(uint64_t s, uint64_t t, const std::string& e);
+
+    /*! Completes and closes the last file, next nodes and edges are ignored.
+    @throw std::runtime_error Writing error. */
+    void close();
+
+    /*! Returns quantity of written nodes.
+    @return Quantity of nodes. */
+    [[nodiscard]] inline size_t nodes() const noexcept {
+      return _nodes;
+    }
+
+    /*! Returns quantity of written edges.
+    @return Quantity of edges. */
+    [[nodiscard]] inline size_t edges() const noexcept {
+      return _edges;
+    }
+
+    /*! Returns true, if nodes or edges are dropped by limits.
+    @return Result of the check. */
+    [[nodiscard]] inline bool truncated() const noexcept {
+      return _truncated;
+    }
+
+    /*! Returns paths of written files.
+    @return Paths in order of writing. */
+    [[nodiscard]] inline const std::vector<std::string>& files() const noexcept {
+      return _files;
+    }
+
+  private:
+
+    /*! Returns true for a node kept by sampling and limits. */
+    [[nodiscard]] bool kept(uint64_t n) const noexcept;
+
+    /*! Opens the next file and writes its header. */
+    void open();
+
+    /*! Writes the footer and the buffer and closes the file. */
+    void finish();
+
+    /*! Writes the buffer into the file and starts the next file after the size limit. */
+    void commit();
+
+    /*! Writes a GraphML node without data for an edge end, if the node is written into an earlier file only. */
+    void stub(uint64_t n);
+
+    GraphExportOptions _options;         ///< Options of export.
+    std::string _path;                   ///< Path to the first file.
+    std::vector<std::string> _files;     ///< Paths of opened files.
+    std::ofstream _file;                 ///< Current file.
+    std::string _buffer;                 ///< Buffer of output.
+    uint64_t _file_size = 0;             ///< Size of the current file without the buffer.
+    uint64_t _threshold;                 ///< Threshold of sampling hashes.
+    uint64_t _cutoff = UINT64_MAX;       ///< Nodes after this identifier are dropped by the limit.
+    uint64_t _file_first = UINT64_MAX;   ///< Identifier of the first node of the current file.
+    std::unordered_set<uint64_t> _stubs; ///< Nodes of earlier files repeated in the current file.
+    size_t _nodes = 0;                   ///< Quantity of written nodes.
+    size_t _edges = 0;                   ///< Quantity of written edges.
+    bool _truncated = false;             ///< Nodes or edges are dropped by limits.
+    bool _closed = false;                ///< The last file is closed.
+
+  }; // GraphExporter class
+
+} // namespace
+
+
+#endif // GRAPH_EXPORT_HPP
@@ -16,6 +16,10 @@ namespace des {
 
 
   /*! Translates the specified automation to DOT description.
+  @details The description is built in a buffer of 1 MB, which is written into the stream by large blocks, the stream
+  is flushed once at the end. Arcs are taken from links of states, so the translation takes time proportional to
+  quantity of states, events and links. An arc with multiplicity greater than 1 is written once with the multiplicity as
+  its label.
   @param o Reference to std::ostream object.
   @param a Automation object.
   @return Reference to std::ostream object. */
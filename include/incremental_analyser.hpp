@@ -0,0 +1,86 @@
+/*! @file incremental_analyser.hpp
+@ref des::IncrementalAnalyser class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef INCREMENTAL_ANALYSER_HPP
+#define INCREMENTAL_ANALYSER_HPP
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "analyse.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Structure of incremental analysis statistics. */
+  struct IncrementalStatistics {
+    size_t FullAnalyses = 0;               ///< Analyses of the whole state space.
+    size_t Updates = 0;                    ///< Local updates of the previous result.
+    size_t ConnectivityRecomputations = 0; ///< Searches over the whole net graph during local updates.
+  };
+
+  /*! Class of an analyser, which updates the result of the previous analysis after small changes of the net.
+  @details This class keeps a snapshot of the last analysed automation and its result. The next automation is analysed
+  anew, unless it's a changed copy of the snapshot with enabled change log (see @ref Automation::enableChangeLog). In
+  that case the changes are compared with the snapshot and the result is updated locally, if the changes don't affect
+  the explored state space of the complete previous analysis:
+  - states and events without links are added or removed;
+  - links of events, which never fired, are changed without decrease of their input multiplicities;
+  - events, which never fired, are removed with their links;
+  - activity tokens of states without output links are changed, activity tokens of states with output links to events,
+  which never fired, are decreased;
+  - types of events are changed.
+
+  These changes keep firing sequences of the net, so verdicts and witness paths are kept, witness markings and dead
+  events are updated. Connectivity is updated by a search over changed part of the net graph, when links are added,
+  and by a search over the whole graph, when the main component loses a state, an event or a link. Other changes
+  start the analysis anew. Statistics and timings of the result are ones of the last complete analysis. */
+  class IncrementalAnalyser {
+  public:
+
+    /*! Constructs an @ref IncrementalAnalyser object.
+    @param o Options of analyses. */
+    explicit IncrementalAnalyser(const AnalysisOptions& o = {});
+
+    /*! Analyses the automation or updates the previous result.
+    @param a Automation object.
+    @return Result of the analysis, it's valid until the next call. */
+    const AnalysisResult& analyse(const Automation& a);
+
+    /*! Forgets the previous result, so the next automation is analysed anew. */
+    void reset() noexcept;
+
+    /*! Returns statistics of incremental analysis.
+    @return Statistics. */
+    [[nodiscard]] inline const IncrementalStatistics& statistics() const noexcept {
+      return _statistics;
+    }
+
+  private:
+
+    /*! Updates the result after changes, returns false, if the analysis must start anew. */
+    bool update(const Automation& a, const std::vector<Change>& c);
+
+    /*! Analyses the automation anew. */
+    void analyseAnew(const Automation& a);
+
+    /*! Searches connectivity over the whole net graph. */
+    void recomputeConnectivity(const Automation& a);
+
+    Analyser _analyser;                 ///< Analyser of the whole state space.
+    AnalysisOptions _options;           ///< Options of analyses.
+    std::optional<Automation> _base;    ///< Snapshot of the last analysed automation.
+    AnalysisResult _result;             ///< Result of the last analysis.
+    std::string _root;                  ///< The least name of the net, the connectivity search starts from it.
+    IncrementalStatistics _statistics;  ///< Statistics.
+
+  }; // IncrementalAnalyser class
+
+} // namespace
+
+
+#endif // INCREMENTAL_ANALYSER_HPP
@@ -0,0 +1,109 @@
+/*! @file marking_store.hpp
+@ref des::MarkingStore class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef MARKING_STORE_HPP
+#define MARKING_STORE_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "compiled_net.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Class of a hashed set of markings with parent links.
+  @details This class stores markings of the same width in one contiguous array and numbers them in order of
+  insertion, so the numbers of markings discovered by breadth-first search form its queue. Each marking keeps number of
+  its parent marking and index of the event fired from the parent, which are enough to rebuild the firing sequence from
+  the first marking. Duplicates are found by open addressing hash table of marking numbers. */
+  class MarkingStore {
+  public:
+
+    /*! Number of absent marking, parent or event. */
+    static const size_t none = UINT32_MAX;
+
+    /*! Constructs an empty @ref MarkingStore object.
+    @param w Quantity of states in each marking. */
+    explicit MarkingStore(size_t w);
+
+    /*! Adds marking into the store, if it's absent.
+    @param m Marking for addition.
+    @param p Number of parent marking.
+    @param e Index of event fired from the parent marking.
+    @return Number of the marking and true, if the marking is added.
+    @throw std::length_error Quantity of markings exceeds 32-bit numbers. */
+    std::pair<size_t, bool> insert(const Marking& m, size_t p = none, size_t e = none);
+
+    /*! Returns number of marking or @ref none, if the marking is absent.
+    @param m Marking for search.
+    @return Number of the marking. */
+    [[nodiscard]] size_t find(const Marking& m) const noexcept;
+
+    /*! Copies marking by number.
+    @param i Number of marking.
+    @param m Marking for copying. */
+    void get(size_t i, Marking& m) const;
+
+    /*! Returns pointer to token quantities of marking by number.
+    @param i Number of marking.
+    @return Pointer to contiguous token quantities. */
+    [[nodiscard]] inline const unsigned* data(size_t i) const noexcept {
+      return _markings.data() + i * _width;
+    }
+
+    /*! Returns number of parent marking or @ref none for the first marking.
+    @param i Number of marking.
+    @return Number of the parent marking. */
+    [[nodiscard]] inline size_t getParent(size_t i) const noexcept {
+      return _parents[i] == UINT32_MAX ? none : _parents[i];
+    }
+
+    /*! Returns index of event fired from the parent marking or @ref none for the first marking.
+    @param i Number of marking.
+    @return Index of the event. */
+    [[nodiscard]] inline size_t getEvent(size_t i) const noexcept {
+      return _events[i] == UINT32_MAX ? none : _events[i];
+    }
+
+    /*! Returns event indexes fired from the first marking to specified marking.
+    @param i Number of marking.
+    @return Firing sequence. */
+    [[nodiscard]] std::vector<size_t> getPath(size_t i) const;
+
+    /*! Returns quantity of markings in the store.
+    @return Quantity of markings. */
+    [[nodiscard]] inline size_t size() const noexcept {
+      return _parents.size();
+    }
+
+    /*! Returns memory allocated by the store.
+    @return Quantity of bytes. */
+    [[nodiscard]] size_t memory() const noexcept;
+
+  private:
+
+    /*! Returns hash of marking.
+    @param m Pointer to token quantities.
+    @return Hash value. */
+    [[nodiscard]] uint64_t hash(const unsigned* m) const noexcept;
+
+    /*! Doubles the hash table. */
+    void grow();
+
+    size_t _width;                   ///< Quantity of states in each marking.
+    std::vector<unsigned> _markings; ///< Token quantities of all markings.
+    std::vector<uint32_t> _parents;  ///< Numbers of parent markings.
+    std::vector<uint32_t> _events;   ///< Indexes of events fired from parent markings.
+    std::vector<uint32_t> _table;    ///< Hash table of marking numbers plus one, zero is empty slot.
+
+  }; // MarkingStore class
+
+} // namespace
+
+
+#endif // MARKING_STORE_HPP
@@ -0,0 +1,72 @@
+/*! @file monte_carlo.hpp
+@ref des::MonteCarloRunner class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef MONTE_CARLO_HPP
+#define MONTE_CARLO_HPP
+
+#include <vector>
+
+#include "simulator.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Structure of Monte Carlo simulation options.
+  @details Each run starts from the initial marking and fires events until @ref Steps or a deadlock. The run number is
+  the random stream of its simulation with @ref SimulatorOptions::Seed of @ref Simulation, so the result doesn't
+  depend on quantity of threads and order of runs. Zero @ref Threads means hardware concurrency. */
+  struct MonteCarloOptions {
+    size_t Runs = 1000;                ///< Quantity of independent runs.
+    uint64_t Steps = 1000;             ///< Max quantity of steps of a run.
+    unsigned Threads = 0;              ///< Quantity of worker threads.
+    SimulatorOptions Simulation = {};  ///< Options of simulation of each run.
+  };
+
+  /*! Structure of Monte Carlo simulation result.
+  @details Frequencies and means are pooled over all runs: @ref FiringFrequencies are shares of events in all fired
+  events, @ref MeanTokens are mean token quantities of states over all visited markings, including initial markings of
+  runs. */
+  struct MonteCarloResult {
+    size_t Runs = 0;                            ///< Quantity of runs.
+    size_t Deadlocks = 0;                       ///< Quantity of runs stopped in a deadlock.
+    double DeadlockRate = 0.0;                  ///< Share of runs stopped in a deadlock.
+    uint64_t Steps = 0;                         ///< Quantity of fired events in all runs.
+    std::vector<uint64_t> Firings = {};         ///< Quantities of firings of events ordered by event index.
+    std::vector<double> FiringFrequencies = {}; ///< Shares of firings of events ordered by event index.
+    std::vector<double> MeanTokens = {};        ///< Mean token quantities of states ordered by state index.
+    double Seconds = 0.0;                       ///< Wall-clock time of the simulation.
+    double FiringsPerSecond = 0.0;              ///< Quantity of fired events per second of wall-clock time.
+  };
+
+  /*! Class of a parallel runner of independent random simulations.
+  @details This class runs simulations of one @ref CompiledNet by several threads. The net is shared by all threads
+  without copying, each thread has its own @ref Simulator and accumulates counters of its runs in its own integer
+  accumulator, which are summed after the threads finish. So threads share only the counter of the next run. */
+  class MonteCarloRunner {
+  public:
+
+    /*! Constructs a @ref MonteCarloRunner object for specified net.
+    @param n Compiled net, it must outlive the runner.
+    @param o Options of simulation. */
+    explicit MonteCarloRunner(const CompiledNet& n, const MonteCarloOptions& o = {});
+
+    /*! Runs all simulations.
+    @return Aggregated result of the runs.
+    @throw std::invalid_argument Options of simulation are invalid for the net.
+    @throw std::system_error Thread can't be started, started threads are joined. */
+    MonteCarloResult run() const;
+
+  private:
+
+    const CompiledNet& _net;     ///< Simulated net.
+    MonteCarloOptions _options;  ///< Options of simulation.
+
+  }; // MonteCarloRunner class
+
+} // namespace
+
+
+#endif // MONTE_CARLO_HPP
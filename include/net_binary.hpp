@@ -0,0 +1,232 @@
+/*! @file net_binary.hpp
+Binary format of Petri nets and @ref des::MappedNet class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef NET_BINARY_HPP
+#define NET_BINARY_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "automation.hpp"
+#include "compiled_net.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Version of binary net format written by @ref writeBinaryNet. */
+  const uint32_t binary_net_version = 1;
+
+  /*! Structure of a reference into the string table of binary net. */
+  struct BinaryString {
+    uint32_t Offset = 0; ///< Offset of the first character in the string table.
+    uint32_t Length = 0; ///< Quantity of characters.
+  };
+
+  /*! Structure of a state record of binary net. */
+  struct BinaryState {
+    BinaryString Name = {}; ///< Name of the state.
+    uint32_t Tokens = 0;    ///< Quantity of activity tokens.
+    uint32_t Reserved = 0;  ///< Zero.
+  };
+
+  /*! Structure of an event record of binary net. */
+  struct BinaryEvent {
+    BinaryString Name = {}; ///< Name of the event.
+    uint32_t Type = 0;      ///< Value of @ref EventType.
+    uint32_t Reserved = 0;  ///< Zero.
+  };
+
+  /*! Structure of the header of binary net.
+  @details The header is followed by sections at 8-byte aligned offsets: the string table, state records and event
+  records ordered by names, input and output link offsets of events (@ref Events + 1 values of type uint32_t each) and
+  link arrays of @ref Arc records with state indexes, masked event offsets and @ref BinaryString references to masked
+  event names. Link arrays have the layout of @ref CompiledNet, so they are used in place. All numbers have byte order
+  of the writer, which is checked by @ref ByteOrder field. */
+  struct BinaryNetHeader {
+    char Magic[4] = { 'D', 'E', 'S', 'N' }; ///< Signature of the format.
+    uint32_t Version = binary_net_version;  ///< Version of the format.
+    uint32_t ByteOrder = 0x01020304;        ///< Byte order mark.
+    uint32_t HeaderSize = 0;                ///< Size of the header in bytes.
+    uint64_t FileSize = 0;                  ///< Size of the file in bytes.
+    uint32_t States = 0;                    ///< Quantity of states.
+    uint32_t Events = 0;                    ///< Quantity of events.
+    uint32_t Inputs = 0;                    ///< Quantity of input links of events.
+    uint32_t Outputs = 0;                   ///< Quantity of output links of events.
+    uint32_t Masked = 0;                    ///< Quantity of masked event references.
+    uint32_t Reserved = 0;                  ///< Zero.
+    uint64_t Strings = 0;                   ///< Offset of the string table.
+    uint64_t StringBytes = 0;               ///< Size of the string table.
+    uint64_t StateTable = 0;                ///< Offset of state records.
+    uint64_t EventTable = 0;                ///< Offset of event records.
+    uint64_t InputOffsets = 0;              ///< Offset of input link offsets.
+    uint64_t InputArcs = 0;                 ///< Offset of input links.
+    uint64_t OutputOffsets = 0;             ///< Offset of output link offsets.
+    uint64_t OutputArcs = 0;                ///< Offset of output links.
+    uint64_t MaskedOffsets = 0;             ///< Offset of masked event offsets.
+    uint64_t MaskedNames = 0;               ///< Offset of masked event references.
+  };
+
+  /*! Writes automation in binary format.
+  @details States, events with types, masked event lists of macro events, links and activity tokens are written. View
+  properties, behavior attributes and mapping rules aren't written.
+  @param o Output stream opened in binary mode.
+  @param a Automation object.
+  @throw std::length_error Quantity of states, events, links or size of names exceeds 32-bit numbers.
+  @throw std::runtime_error Writing error. */
+  void writeBinaryNet(std::ostream& o, const Automation& a);
+
+  /*! Writes automation in binary format into file.
+  @param p Path to the file.
+  @param a Automation object.
+  @throw std::runtime_error File can't be created or written. */
+  void writeBinaryNetFile(const std::string& p, const Automation& a);
+
+  /*! Class of a read-only view of binary net.
+  @details This class maps a file with binary net into memory (or reads it, where memory mapping isn't available) and
+  checks the header and all references once, then names, tokens and links are accessed in place without parsing and
+  allocation. The view converts into @ref Automation by @ref AutomationBuilder without sorting of names and into
+  @ref CompiledNet by copying of link arrays. */
+  class MappedNet {
+  public:
+
+    /*! Maps binary net file.
+    @param p Path to the file.
+    @throw std::runtime_error File can't be opened or isn't a valid binary net. */
+    explicit MappedNet(const std::string& p);
+
+    /*! Constructs a view of binary net in memory.
+    @param d Pointer to the 8-byte aligned data, it must outlive the view.
+    @param s Size of the data in bytes.
+    @throw std::runtime_error Data isn't a valid binary net. */
+    MappedNet(const void* d, size_t s);
+
+    MappedNet(const MappedNet&) = delete;
+    MappedNet& operator=(const MappedNet&) = delete;
+
+    /*! Unmaps the file. */
+    ~MappedNet();
+
+    /*! Returns quantity of states.
+    @return Quantity of states. */
+    [[nodiscard]] inline size_t getStateQuantity() const noexcept {
+      return _header->States;
+    }
+
+    /*! Returns quantity of events.
+    @return Quantity of events. */
+    [[nodiscard]] inline size_t getEventQuantity() const noexcept {
+      return _header->Events;
+    }
+
+    /*! Returns name of state by index, states are ordered by names.
+    @param i Index of state.
+    @return Name of the state. */
+    [[nodiscard]] inline std::string_view getStateName(size_t i) const noexcept {
+      return text(_states[i].Name);
+    }
+
+    /*! Returns quantity of activity tokens of state by index.
+    @param i Index of state.
+    @return Quantity of tokens. */
+    [[nodiscard]] inline unsigned getActivity(size_t i) const noexcept {
+      return _states[i].Tokens;
+    }
+
+    /*! Returns name of event by index, events are ordered by names.
+    @param i Index of event.
+    @return Name of the event. */
+    [[nodiscard]] inline std::string_view getEventName(size_t i) const noexcept {
+      return text(_events[i].Name);
+    }
+
+    /*! Returns type of event by index.
+    @param i Index of event.
+    @return Type of the event. */
+    [[nodiscard]] inline EventType getType(size_t i) const noexcept {
+      return static_cast<EventType>(_events[i].Type);
+    }
+
+    /*! Returns input links of event, @ref Arc::Index is a state index.
+    @param t Index of event.
+    @return Range of links in the mapped data. */
+    [[nodiscard]] inline ArcRange getEventInputs(size_t t) const noexcept {
+      return { _inputs + _input_offsets[t], _inputs + _input_offsets[t + 1] };
+    }
+
+    /*! Returns output links of event, @ref Arc::Index is a state index.
+    @param t Index of event.
+    @return Range of links in the mapped data. */
+    [[nodiscard]] inline ArcRange getEventOutputs(size_t t) const noexcept {
+      return { _outputs + _output_offsets[t], _outputs + _output_offsets[t + 1] };
+    }
+
+    /*! Returns quantity of masked events of macro event.
+    @param t Index of event.
+    @return Quantity of masked events. */
+    [[nodiscard]] inline size_t getMaskedEventQuantity(size_t t) const noexcept {
+      return _masked_offsets[t + 1] - _masked_offsets[t];
+    }
+
+    /*! Returns name of masked event of macro event.
+    @param t Index of event.
+    @param k Index of masked event in the list.
+    @return Name of the masked event. */
+    [[nodiscard]] inline std::string_view getMaskedEvent(size_t t, size_t k) const noexcept {
+      return text(_masked[_masked_offsets[t] + k]);
+    }
+
+    /*! Returns all input links of events in order of event indexes.
+    @return Range of links in the mapped data. */
+    [[nodiscard]] inline ArcRange getInputs() const noexcept {
+      return { _inputs, _inputs + _header->Inputs };
+    }
+
+    /*! Returns all output links of events in order of event indexes.
+    @return Range of links in the mapped data. */
+    [[nodiscard]] inline ArcRange getOutputs() const noexcept {
+      return { _outputs, _outputs + _header->Outputs };
+    }
+
+    /*! Creates automation with states, events and links of the binary net.
+    @return Automation object.
+    @throw std::invalid_argument Binary net contains invalid or repeated name.
+    @throw std::runtime_error Masked events list of macro event refers to nonexistent event. */
+    [[nodiscard]] Automation toAutomation() const;
+
+  private:
+
+    /*! Returns string by reference into the string table. */
+    [[nodiscard]] inline std::string_view text(const BinaryString& s) const noexcept {
+      return { _strings + s.Offset, s.Length };
+    }
+
+    /*! Checks the header and references, sets section pointers.
+    @param s Size of the data in bytes. */
+    void attach(size_t s);
+
+    const char* _data = nullptr;                ///< Binary net data.
+    size_t _mapped_size = 0;                    ///< Size of mapped file or zero for data not owned by the view.
+    std::vector<uint64_t> _buffer;              ///< Data read from file, where memory mapping isn't available.
+    const BinaryNetHeader* _header = nullptr;   ///< Header.
+    const char* _strings = nullptr;             ///< String table.
+    const BinaryState* _states = nullptr;       ///< State records.
+    const BinaryEvent* _events = nullptr;       ///< Event records.
+    const uint32_t* _input_offsets = nullptr;   ///< Offsets of input links.
+    const Arc* _inputs = nullptr;               ///< Input links.
+    const uint32_t* _output_offsets = nullptr;  ///< Offsets of output links.
+    const Arc* _outputs = nullptr;              ///< Output links.
+    const uint32_t* _masked_offsets = nullptr;  ///< Offsets of masked event references.
+    const BinaryString* _masked = nullptr;      ///< Masked event references.
+
+  }; // MappedNet class
+
+} // namespace
+
+
+#endif // NET_BINARY_HPP
@@ -0,0 +1,51 @@
+/*! @file net_text.hpp
+Text format of Petri nets header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef NET_TEXT_HPP
+#define NET_TEXT_HPP
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include "automation.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Reads automation from text description.
+  @details The description consists of lines with one record each, empty lines and text after '#' are ignored:
+  @code
+  state <name> [tokens]
+  event <name> [controllable|uncontrollable|expected]
+  arc <state> <event> [multiplicity]
+  arc <event> <state> [multiplicity]
+  @endcode
+  States and events must be declared before arcs linking them. Default quantity of tokens is 0, default event type is
+  controllable and default multiplicity is 1.
+  @param i Input stream.
+  @return Read automation.
+  @throw std::runtime_error Syntax error, the message contains number of the line.
+  @throw std::invalid_argument Invalid or duplicate name of state or event. */
+  Automation readNet(std::istream& i);
+
+  /*! Reads automation from text description file.
+  @param p Path to the file.
+  @return Read automation.
+  @throw std::runtime_error File can't be opened or has syntax error. */
+  Automation readNetFile(const std::string& p);
+
+  /*! Writes automation as text description, which @ref readNet reads back.
+  @details Macro events are written as controllable events, view properties aren't written.
+  @param o Output stream.
+  @param a Automation object.
+  @return Reference to the output stream. */
+  std::ostream& writeNet(std::ostream& o, const Automation& a);
+
+} // namespace
+
+
+#endif // NET_TEXT_HPP
@@ -0,0 +1,58 @@
+/*! @file pnml.hpp
+PNML importer header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef PNML_HPP
+#define PNML_HPP
+
+#include <chrono>
+#include <istream>
+#include <string>
+
+#include "automation.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Structure of PNML import statistics. */
+  struct PnmlStatistics {
+    size_t Bytes = 0;                          ///< Quantity of read bytes.
+    size_t Places = 0;                         ///< Quantity of imported places.
+    size_t Transitions = 0;                    ///< Quantity of imported transitions.
+    size_t Arcs = 0;                           ///< Quantity of imported arcs.
+    std::chrono::microseconds Duration{ 0 };   ///< Wall-clock time of the import.
+
+    /*! Returns parse throughput.
+    @return Quantity of megabytes per second. */
+    [[nodiscard]] inline double throughput() const noexcept {
+      return Duration.count() ? static_cast<double>(Bytes) / static_cast<double>(Duration.count()) : 0.0;
+    }
+  };
+
+  /*! Reads automation from PNML document of place/transition net (ISO/IEC 15909-2).
+  @details The document is read by a streaming parser in fixed-size chunks without building of document tree, only
+  places, transitions, arcs, initial markings, arc inscriptions and reference nodes are kept, so memory depends on the
+  size of the net and not on the size of the document with its graphics and tool-specific data. Places become states,
+  transitions become controllable events, reference places and transitions are replaced by referenced nodes, parallel
+  arcs are merged with sum of inscriptions. Node identifiers become names: characters not allowed by
+  @ref checkNameString are replaced by underscores, names not starting with a letter get "n_" prefix and repeating
+  names get numeric suffixes. Pages are flattened, several nets of one document are merged.
+  @param i Input stream.
+  @param s Pointer to statistics of the import or null pointer.
+  @return Read automation.
+  @throw std::runtime_error Malformed document or net, the message contains number of the line. */
+  Automation readPnml(std::istream& i, PnmlStatistics* s = nullptr);
+
+  /*! Reads automation from PNML file.
+  @param p Path to the file.
+  @param s Pointer to statistics of the import or null pointer.
+  @return Read automation.
+  @throw std::runtime_error File can't be opened or has malformed document. */
+  Automation readPnmlFile(const std::string& p, PnmlStatistics* s = nullptr);
+
+} // namespace
+
+
+#endif // PNML_HPP
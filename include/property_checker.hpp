@@ -0,0 +1,121 @@
+/*! @file property_checker.hpp
+@ref des::PropertyChecker class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef PROPERTY_CHECKER_HPP
+#define PROPERTY_CHECKER_HPP
+
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "analysis_control.hpp"
+#include "compiled_net.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Enumeration of property kinds checked on the fly. */
+  enum class PropertyKind {
+    deadlockFreedom, ///< Every reachable marking has a ready event.
+    bound,           ///< Token quantity of specified states never exceeds the bound.
+    target           ///< A marking satisfying the predicate is reachable.
+  };
+
+  /*! Type of target predicate over markings of @ref CompiledNet. */
+  using MarkingPredicate = std::function<bool(const Marking&)>;
+
+  /*! Structure of a property verdict.
+  @details Verdict of a safety property (@ref PropertyKind::deadlockFreedom and @ref PropertyKind::bound) is no with
+  the shortest path to a violating marking or yes after exhaustive exploration. Verdict of a target property is yes with
+  the shortest path to a target marking or no after exhaustive exploration. */
+  struct PropertyVerdict {
+    std::string Name = "";                          ///< Name of the property.
+    PropertyKind Kind = PropertyKind::target;       ///< Kind of the property.
+    Verdict Value = Verdict::unknown;               ///< Verdict of the property.
+    std::optional<Witness> Trace = std::nullopt;    ///< Path to violating or target marking.
+    size_t States = 0;                              ///< Quantity of markings explored before the decision.
+  };
+
+  /*! Structure of on-the-fly property check result.
+  @details Status is @ref AnalysisStatus::complete, if all properties are decided, even when the state space isn't
+  explored exhaustively. */
+  struct PropertyCheckResult {
+    std::vector<PropertyVerdict> Properties = {};     ///< Verdicts in order of property addition.
+    AnalysisStatus Status = AnalysisStatus::complete; ///< Completion status.
+    AnalysisStatistics Statistics = {};               ///< Statistics of the exploration.
+
+    /*! Returns true, if all properties are decided.
+    @return Result of the check. */
+    [[nodiscard]] inline bool decided() const noexcept {
+      for (const auto& p : Properties) {
+        if (p.Value == Verdict::unknown) {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+
+  /*! Class of an on-the-fly property checker.
+  @details This class explores the reachability set of a @ref CompiledNet breadth-first and checks selected properties
+  on every discovered marking. The exploration stops as soon as every property is decided, so a violation near the
+  initial marking is found without building the whole state space, and witnesses are the shortest firing sequences.
+  Markings aren't accelerated, so a bound or deadlock freedom of an unbounded net is decided only by a violation, the
+  other properties of such net stay unknown after a limit of @ref AnalysisOptions. */
+  class PropertyChecker {
+  public:
+
+    /*! Constructs a @ref PropertyChecker object for specified net without properties.
+    @param n Compiled net, it must outlive the checker. */
+    explicit PropertyChecker(const CompiledNet& n);
+
+    /*! Adds deadlock freedom property.
+    @param n Name of the property.
+    @return Index of the property in the result. */
+    size_t addDeadlockFreedom(const std::string& n = "deadlock freedom");
+
+    /*! Adds bound property of specified states.
+    @param s Names of states, empty set means all states.
+    @param k Max token quantity of each state.
+    @param n Name of the property.
+    @return Index of the property in the result.
+    @throw std::invalid_argument The net hasn't a state with specified name. */
+    size_t addBound(const std::set<std::string>& s, unsigned k = 1, const std::string& n = "bound");
+
+    /*! Adds reachability of target marking property.
+    @param p Predicate of target markings.
+    @param n Name of the property.
+    @return Index of the property in the result.
+    @throw std::invalid_argument Predicate is empty. */
+    size_t addTarget(const MarkingPredicate& p, const std::string& n = "target");
+
+    /*! Explores the reachability set until all properties are decided.
+    @param o Limits of the exploration.
+    @return Verdicts of the properties.
+    @throw std::logic_error The checker has no properties. */
+    [[nodiscard]] PropertyCheckResult run(const AnalysisOptions& o = AnalysisOptions()) const;
+
+  private:
+
+    /*! Structure of a checked property. */
+    struct Property {
+      std::string Name;              ///< Name of the property.
+      PropertyKind Kind;             ///< Kind of the property.
+      std::vector<size_t> States;    ///< Indexes of bounded states.
+      unsigned Bound;                ///< Max token quantity.
+      MarkingPredicate Predicate;    ///< Predicate of target markings.
+    };
+
+    const CompiledNet& _net;               ///< Explored net.
+    std::vector<Property> _properties;     ///< Checked properties.
+
+  }; // PropertyChecker class
+
+} // namespace
+
+
+#endif // PROPERTY_CHECKER_HPP
@@ -0,0 +1,108 @@
+/*! @file result_cache.hpp
+@ref des::ResultCache class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef RESULT_CACHE_HPP
+#define RESULT_CACHE_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "analysis_control.hpp"
+#include "fingerprint.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Default limit of total size of cached results in bytes. */
+  const uint64_t default_cache_size = 64ULL << 20;
+
+  /*! Default quantity of entries of the cache index. */
+  const uint32_t default_cache_entries = 4096;
+
+  /*! Class of a persistent cache of analysis results.
+  @details This class stores results of @ref Analyser::run_analyse in a directory: one value file for each result and
+  an index file mapped into memory with keys, sizes and times of last use of all entries. The key combines structural
+  @ref Fingerprint of the net with @ref AnalysisOptions::MaxMemory and @ref AnalysisOptions::MaxStates limits. Only
+  deterministic results are stored: complete ones and ones stopped by memory or state limits, so the time limit isn't
+  a part of the key. Value files are written into temporary files and renamed, the index is changed under exclusive
+  file lock, so several processes and threads can share one directory. The least recently used entries are evicted,
+  when total size of values exceeds the limit or the index is full. Damaged or missing value files are treated as
+  misses. The cache can be used from several threads at once. It requires POSIX memory mapping and file locks. */
+  class ResultCache {
+  public:
+
+    /*! Opens the cache directory, the directory and the index are created, if they don't exist.
+    @details Quantity of index entries is set by the process, which creates the index, and it can't be changed later.
+    @param d Path to the directory.
+    @param s Limit of total size of cached results in bytes.
+    @param n Quantity of index entries for new index.
+    @throw std::runtime_error The directory or the index can't be created or the index is invalid. */
+    explicit ResultCache(const std::string& d, uint64_t s = default_cache_size, uint32_t n = default_cache_entries);
+
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    /*! Unmaps the index. */
+    ~ResultCache();
+
+    /*! Returns cached result and marks it as recently used.
+    @param f Fingerprint of the net.
+    @param o Analysis options.
+    @return Cached result or std::nullopt. */
+    [[nodiscard]] std::optional<AnalysisResult> find(const Fingerprint& f, const AnalysisOptions& o);
+
+    /*! Stores result, the previous result with the same key is replaced.
+    @details Nothing is stored for nondeterministic result (see @ref cacheable), result larger than the size limit or
+    after writing error.
+    @param f Fingerprint of the net.
+    @param o Analysis options.
+    @param r Analysis result.
+    @return True for stored result. */
+    bool insert(const Fingerprint& f, const AnalysisOptions& o, const AnalysisResult& r);
+
+    /*! Removes all results. */
+    void clear();
+
+    /*! Returns quantity of cached results.
+    @return Quantity of results. */
+    [[nodiscard]] size_t size() const;
+
+    /*! Returns total size of cached results.
+    @return Size in bytes. */
+    [[nodiscard]] uint64_t bytes() const;
+
+    /*! Returns true for result, which doesn't depend on the time of analysis.
+    @param r Analysis result.
+    @return Result of the check. */
+    [[nodiscard]] static bool cacheable(const AnalysisResult& r) noexcept;
+
+  private:
+
+    /*! Class of exclusive lock of the index by the thread and by the process. */
+    class Lock;
+
+    /*! Returns path of value file by key. */
+    [[nodiscard]] std::string valuePath(const Fingerprint& k) const;
+
+    /*! Removes index entry and its value file, the index must be locked. */
+    void evict(size_t i) noexcept;
+
+    std::string _directory;           ///< Path to the directory.
+    uint64_t _limit;                  ///< Limit of total size of values.
+    int _file = -1;                   ///< Descriptor of the index file.
+    char* _index = nullptr;           ///< Mapped index.
+    size_t _index_size = 0;           ///< Size of the index in bytes.
+    mutable std::mutex _mutex;        ///< Lock of the index by threads.
+    uint64_t _counter;                ///< Counter of temporary files, it starts from random number.
+
+  }; // ResultCache class
+
+} // namespace
+
+
+#endif // RESULT_CACHE_HPP
@@ -0,0 +1,330 @@
+/*! @file shared_dictionary.hpp
+@ref des::SharedDictionary class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef SHARED_DICTIONARY_HPP
+#define SHARED_DICTIONARY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Template class of an ordered dictionary with structural sharing of copies.
+  @details This class keeps values in sorted blocks (leaves) of limited size, the leaves are listed by the root array.
+  The root, the leaves and the values are held by shared pointers, so a copy of the dictionary takes constant time and
+  shares everything with the original. A change of a value copies the root array, one leaf and the value only, if they
+  are shared with other copies, so a copy with a few changes takes memory of these changes. Values are never changed
+  in place while shared, which makes copies safe for use in different threads. Values, leaves and the root are
+  allocated from the memory resource of the dictionary, @a T is constructed with the allocator, if it's
+  allocator-aware.
+  @tparam T Type of values, it must be copy constructible. */
+  template<class T>
+  class SharedDictionary {
+  public:
+
+    /*! Structure of a dictionary entry. */
+    struct Entry {
+      std::string Name;         ///< Key.
+      std::shared_ptr<T> Value; ///< Value, it's immutable while it's shared.
+    };
+
+    /*! Type of a leaf with sorted entries. */
+    using Leaf = std::pmr::vector<Entry>;
+
+    /*! Type of the root with leaves in order of keys. */
+    using Root = std::pmr::vector<std::shared_ptr<Leaf>>;
+
+    /*! Class of an iterator over entries in order of keys, it gives pairs of references to keys and values. */
+    class const_iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = std::pair<const std::string&, const T&>;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = value_type;
+
+      const_iterator() noexcept = default;
+
+      inline value_type operator*() const noexcept {
+        const Entry& e = (*(*_root)[_leaf])[_position];
+        return { e.Name, *e.Value };
+      }
+
+      inline const_iterator& operator++() noexcept {
+        if (++_position == (*_root)[_leaf]->size()) {
+          _leaf++;
+          _position = 0;
+        }
+        return *this;
+      }
+
+      inline const_iterator operator++(int) noexcept {
+        const_iterator result = *this;
+        ++*this;
+        return result;
+      }
+
+      inline bool operator==(const const_iterator& i) const noexcept {
+        return _leaf == i._leaf && _position == i._position;
+      }
+
+      inline bool operator!=(const const_iterator& i) const noexcept {
+        return !(*this == i);
+      }
+
+    private:
+      friend class SharedDictionary;
+
+      const_iterator(const Root* r, size_t l, size_t p) noexcept : _root(r), _leaf(l), _position(p) {}
+
+      const Root* _root = nullptr;
+      size_t _leaf = 0;
+      size_t _position = 0;
+    }; // const_iterator class
+
+    /*! Constructs an empty @ref SharedDictionary object.
+    @param r Memory resource, it must outlive the dictionary and all its copies. */
+    explicit SharedDictionary(std::pmr::memory_resource* r = std::pmr::get_default_resource()) noexcept :
+      _resource(r), _root(), _size(0) {}
+
+    /*! Constructs a @ref SharedDictionary object sharing all data with other object in constant time. */
+    SharedDictionary(const SharedDictionary&) = default;
+
+    /*! Constructs a @ref SharedDictionary object by moving of other object. */
+    SharedDictionary(SharedDictionary&& d) noexcept : _resource(d._resource), _root(std::move(d._root)),
+      _size(std::exchange(d._size, 0)) {}
+
+    /*! Assigns value of other @ref SharedDictionary object, the memory resource isn't changed.
+    @details Data is shared for equal memory resources, otherwise it's copied. */
+    SharedDictionary& operator=(const SharedDictionary& d) {
+      if (this != &d) {
+        SharedDictionary copy = _resource->is_equal(*d._resource) ? d : SharedDictionary(d, _resource);
+        _root = std::move(copy._root);
+        _size = copy._size;
+      }
+      return *this;
+    }
+
+    /*! Assigns value of other @ref SharedDictionary object by moving, the memory resource isn't changed.
+    @details Data is moved for equal memory resources, otherwise it's copied. */
+    SharedDictionary& operator=(SharedDictionary&& d) {
+      if (!_resource->is_equal(*d._resource)) {
+        return *this = static_cast<const SharedDictionary&>(d);
+      }
+      _root = std::move(d._root);
+      _size = std::exchange(d._size, 0);
+      return *this;
+    }
+
+    /*! Constructs a @ref SharedDictionary object by deep copying of other object into specified memory resource.
+    @param d Dictionary for copying.
+    @param r Memory resource, it must outlive the dictionary and all its copies. */
+    SharedDictionary(const SharedDictionary& d, std::pmr::memory_resource* r) : SharedDictionary(r) {
+      for (const auto& e : d) {
+        append(e.first, T(e.second));
+      }
+    }
+
+    /*! Returns memory resource of the dictionary.
+    @return Pointer to the memory resource. */
+    [[nodiscard]] inline std::pmr::memory_resource* resource() const noexcept {
+      return _resource;
+    }
+
+    /*! Returns quantity of entries.
+    @return Quantity of entries. */
+    [[nodiscard]] inline size_t size() const noexcept {
+      return _size;
+    }
+
+    /*! Returns true for the dictionary without entries.
+    @return Result of the check. */
+    [[nodiscard]] inline bool empty() const noexcept {
+      return _size == 0;
+    }
+
+    /*! Returns iterator to the first entry.
+    @return Iterator. */
+    [[nodiscard]] inline const_iterator begin() const noexcept {
+      return { _root.get(), 0, 0 };
+    }
+
+    /*! Returns iterator after the last entry.
+    @return Iterator. */
+    [[nodiscard]] inline const_iterator end() const noexcept {
+      return { _root.get(), _root ? _root->size() : 0, 0 };
+    }
+
+    /*! Returns value by key without changes of sharing.
+    @param n Key.
+    @return Pointer to the value or null pointer for absent key. */
+    [[nodiscard]] const T* find(const std::string& n) const noexcept {
+      size_t l = 0, p = 0;
+      return locate(n, l, p) ? (*_root)[l]->at(p).Value.get() : nullptr;
+    }
+
+    /*! Returns value by key for change, the value, its leaf and the root are copied, if they are shared.
+    @param n Key.
+    @return Pointer to the value or null pointer for absent key. */
+    T* modify(const std::string& n) {
+      size_t l = 0, p = 0;
+      if (!locate(n, l, p)) {
+        return nullptr;
+      }
+      Entry& e = ownLeaf(l)[p];
+      if (!isUnique(e.Value)) {
+        e.Value = std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource()), *e.Value);
+      }
+      return e.Value.get();
+    }
+
+    /*! Adds new entry, nothing happens for existing key.
+    @param n Key.
+    @param v Value (move semantic).
+    @return True for added entry. */
+    bool insert(const std::string& n, T&& v) {
+      size_t l = 0, p = 0;
+      if (locate(n, l, p)) {
+        return false;
+      }
+      if (!_root || _root->empty()) {
+        append(n, std::move(v));
+        return true;
+      }
+      auto& leaf = ownLeaf(l);
+      leaf.insert(leaf.begin() + static_cast<std::ptrdiff_t>(p), makeEntry(n, std::move(v)));
+      if (leaf.size() > 2 * leaf_size) { // the leaf is split in halves
+        auto half = std::allocate_shared<Leaf>(std::pmr::polymorphic_allocator<Leaf>(resource()));
+        half->reserve(2 * leaf_size);
+        std::move(leaf.begin() + leaf_size, leaf.end(), std::back_inserter(*half));
+        leaf.resize(leaf_size);
+        _root->insert(_root->begin() + static_cast<std::ptrdiff_t>(l) + 1, std::move(half));
+      }
+      _size++;
+      return true;
+    }
+
+    /*! Adds new entry with key greater than all keys of the dictionary.
+    @details This method is intended for bulk construction, it fills leaves to the end.
+    @param n Key.
+    @param v Value (move semantic).
+    @return Reference to the added value. */
+    T& append(std::string n, T&& v) {
+      if (!_root || _root->empty() || _root->back()->size() >= leaf_size) {
+        ownRoot().push_back(std::allocate_shared<Leaf>(std::pmr::polymorphic_allocator<Leaf>(resource())));
+        _root->back()->reserve(leaf_size);
+      }
+      auto& leaf = ownLeaf(_root->size() - 1);
+      leaf.push_back(makeEntry(std::move(n), std::move(v)));
+      _size++;
+      return *leaf.back().Value;
+    }
+
+    /*! Removes entry, nothing happens for absent key.
+    @param n Key.
+    @return True for removed entry. */
+    bool erase(const std::string& n) {
+      size_t l = 0, p = 0;
+      if (!locate(n, l, p)) {
+        return false;
+      }
+      auto& leaf = ownLeaf(l);
+      leaf.erase(leaf.begin() + static_cast<std::ptrdiff_t>(p));
+      if (leaf.empty()) {
+        _root->erase(_root->begin() + static_cast<std::ptrdiff_t>(l));
+      }
+      _size--;
+      return true;
+    }
+
+    /*! Returns quantity of bytes used by the dictionary without values.
+    @details Leaves and the root shared with other copies are counted too.
+    @return Quantity of bytes. */
+    [[nodiscard]] size_t memory() const noexcept {
+      if (!_root) {
+        return 0;
+      }
+      size_t result = _root->capacity() * sizeof(std::shared_ptr<Leaf>);
+      for (const auto& l : *_root) {
+        result += sizeof(Leaf) + l->capacity() * sizeof(Entry);
+      }
+      return result;
+    }
+
+  private:
+
+    /*! Quantity of entries in leaves filled by @ref append, leaves are split, when they have twice more entries. */
+    static const size_t leaf_size = 64;
+
+    /*! Returns true for object, which isn't shared.
+    @details The acquire fence orders the following changes after releases of the object by other threads. */
+    template<class P>
+    static bool isUnique(const std::shared_ptr<P>& p) noexcept {
+      if (p.use_count() == 1) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+      }
+      return false;
+    }
+
+    /*! Creates entry with value allocated from the memory resource. */
+    Entry makeEntry(std::string n, T&& v) {
+      return { std::move(n), std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource()), std::move(v)) };
+    }
+
+    /*! Finds leaf and position of key, returns true for existing key. */
+    bool locate(const std::string& n, size_t& l, size_t& p) const noexcept {
+      l = p = 0;
+      if (!_root || _root->empty()) {
+        return false;
+      }
+      const auto leaf = std::upper_bound(_root->begin(), _root->end(), n,
+        [](const std::string& k, const std::shared_ptr<Leaf>& x) { return k < x->front().Name; });
+      l = leaf == _root->begin() ? 0 : static_cast<size_t>(leaf - _root->begin()) - 1;
+      const Leaf& entries = *(*_root)[l];
+      const auto entry = std::lower_bound(entries.begin(), entries.end(), n,
+        [](const Entry& x, const std::string& k) { return x.Name < k; });
+      p = static_cast<size_t>(entry - entries.begin());
+      return entry != entries.end() && entry->Name == n;
+    }
+
+    /*! Returns the root for change, it's created or copied, if it's shared. */
+    Root& ownRoot() {
+      if (!_root) {
+        _root = std::allocate_shared<Root>(std::pmr::polymorphic_allocator<Root>(resource()));
+      }
+      else if (!isUnique(_root)) {
+        _root = std::allocate_shared<Root>(std::pmr::polymorphic_allocator<Root>(resource()), *_root);
+      }
+      return *_root;
+    }
+
+    /*! Returns leaf for change, the root and the leaf are copied, if they are shared. */
+    Leaf& ownLeaf(size_t l) {
+      auto& leaf = ownRoot()[l];
+      if (!isUnique(leaf)) {
+        leaf = std::allocate_shared<Leaf>(std::pmr::polymorphic_allocator<Leaf>(resource()), *leaf);
+      }
+      return *leaf;
+    }
+
+    std::pmr::memory_resource* _resource; ///< Memory resource.
+    std::shared_ptr<Root> _root;          ///< Root or null pointer for empty dictionary.
+    size_t _size;                         ///< Quantity of entries.
+
+  }; // SharedDictionary class
+
+} // namespace
+
+
+#endif // SHARED_DICTIONARY_HPP
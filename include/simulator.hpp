@@ -0,0 +1,142 @@
+/*! @file simulator.hpp
+@ref des::Simulator class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef SIMULATOR_HPP
+#define SIMULATOR_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "compiled_net.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Enumeration of policies choosing the fired event among ready events. */
+  enum class FiringPolicy {
+    random,     ///< Uniformly random ready event.
+    priority,   ///< Ready event with the greatest priority, random one of equal priorities.
+    roundRobin  ///< The first ready event after the last fired one in cyclic order of indexes.
+  };
+
+  /*! Structure of token game simulation options.
+  @details @ref Priorities contains priorities of events ordered by event index, absent values are zero. The seed and
+  the stream define the whole sequence of random choices, so simulations with the same options fire the same events.
+  Random numbers are computed from the counter of choices, so simulations with different streams are independent and
+  any of them can be repeated separately. */
+  struct SimulatorOptions {
+    FiringPolicy Policy = FiringPolicy::random; ///< Policy of event choice.
+    uint64_t Seed = 0;                          ///< Seed of random choices.
+    uint64_t Stream = 0;                        ///< Number of random stream for the seed.
+    std::vector<int> Priorities = {};           ///< Priorities of events for @ref FiringPolicy::priority.
+  };
+
+  /*! Structure of token game simulation result. */
+  struct SimulationResult {
+    uint64_t Steps = 0;            ///< Quantity of fired events.
+    bool Deadlock = false;         ///< True, if the simulation stopped in a marking without ready events.
+    double Seconds = 0.0;          ///< Wall-clock time of the simulation.
+    double FiringsPerSecond = 0.0; ///< Quantity of fired events per second of wall-clock time.
+  };
+
+  /*! Class of a token game simulator.
+  @details This class plays the token game of a @ref CompiledNet from its initial marking: each step fires one ready
+  event chosen by the policy of @ref SimulatorOptions. Unlike @ref Automation::fire the simulator doesn't check all
+  events after firing: each event keeps quantity of its unsatisfied input links, and firing updates only events
+  consuming from changed states (see @ref CompiledNet::getStateConsumers), so the set of ready events is kept
+  incrementally. All buffers are allocated at construction, a step neither allocates memory nor looks up names. Token
+  quantities are saturated like in @ref CompiledNet::fire. */
+  class Simulator {
+  public:
+
+    /*! Index of absent event. */
+    static const size_t none = UINT32_MAX;
+
+    /*! Constructs a @ref Simulator object in the initial marking of the net.
+    @param n Compiled net, it must outlive the simulator.
+    @param o Options of simulation.
+    @throw std::invalid_argument Quantity of priorities exceeds quantity of events. */
+    explicit Simulator(const CompiledNet& n, const SimulatorOptions& o = {});
+
+    /*! Returns the simulator into the initial marking, resets counters and random choices. */
+    void reset();
+
+    /*! Returns the simulator into the initial marking and switches random choices to another stream.
+    @param s Number of random stream. */
+    void reset(uint64_t s);
+
+    /*! Fires one ready event chosen by the policy.
+    @return Index of the fired event or @ref none, if there are no ready events. */
+    size_t step() noexcept;
+
+    /*! Fires events until specified quantity of steps or a deadlock.
+    @param n Quantity of steps.
+    @return Result of the simulation. */
+    SimulationResult run(uint64_t n);
+
+    /*! Returns the current marking.
+    @return Token quantities of states ordered by state index. */
+    [[nodiscard]] inline const Marking& getMarking() const noexcept {
+      return _marking;
+    }
+
+    /*! Returns quantities of firings of events since construction or reset.
+    @return Quantities ordered by event index. */
+    [[nodiscard]] inline const std::vector<uint64_t>& getFiringCounts() const noexcept {
+      return _firings;
+    }
+
+    /*! Returns quantity of fired events since construction or reset.
+    @return Quantity of steps. */
+    [[nodiscard]] inline uint64_t getStepQuantity() const noexcept {
+      return _steps;
+    }
+
+    /*! Returns sums of token quantities of states over markings since construction or reset.
+    @details The sums include the initial marking and the marking after each step, so division by the quantity of
+    steps plus one gives mean token quantities. They are accumulated only on changes of states.
+    @param s Sums ordered by state index. */
+    void getTokenSums(std::vector<uint64_t>& s) const;
+
+    /*! Returns quantity of ready events in the current marking.
+    @return Quantity of ready events. */
+    [[nodiscard]] inline size_t getReadyQuantity() const noexcept {
+      return _ready_size;
+    }
+
+  private:
+
+    /*! Returns the next random number. */
+    inline uint64_t generate() noexcept;
+
+    /*! Chooses ready event by the policy. */
+    inline uint32_t choose() noexcept;
+
+    /*! Changes token quantity of state and updates ready events consuming from it. */
+    inline void change(uint32_t s, unsigned q) noexcept;
+
+    const CompiledNet& _net;                  ///< Simulated net.
+    SimulatorOptions _options;                ///< Options of simulation.
+    Marking _marking;                         ///< Current marking.
+    std::vector<uint32_t> _missing;           ///< Quantities of unsatisfied input links of events.
+    std::vector<uint32_t> _ready;             ///< Ready events, the first @ref _ready_size items are used.
+    std::vector<uint32_t> _positions;         ///< Positions of ready events in @ref _ready.
+    std::vector<uint32_t> _candidates;        ///< Buffer of ready events with equal priorities.
+    size_t _ready_size = 0;                   ///< Quantity of ready events.
+    std::vector<uint64_t> _firings;           ///< Quantities of firings of events.
+    std::vector<uint64_t> _token_sums;        ///< Sums of token quantities until the last change of states.
+    std::vector<uint64_t> _changes;           ///< Numbers of the first markings with current token quantities.
+    uint64_t _key = 0;                        ///< Key of the random stream.
+    uint64_t _steps = 0;                      ///< Quantity of fired events.
+    uint64_t _counter = 0;                    ///< Counter of random numbers.
+    uint32_t _last = 0;                       ///< Index of the last fired event.
+
+  }; // Simulator class
+
+} // namespace
+
+
+#endif // SIMULATOR_HPP
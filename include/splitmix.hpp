@@ -0,0 +1,43 @@
+/*! @file splitmix.hpp
+Bit mixing of splitmix64 generator header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef SPLITMIX_HPP
+#define SPLITMIX_HPP
+
+#include <cstdint>
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Increment of splitmix64 generator (2^64 divided by the golden ratio). */
+  const uint64_t golden_gamma = 0x9e3779b97f4a7c15ULL;
+
+  /*! Mixes bits of a 64-bit number by the finalizer of splitmix64 generator.
+  @details This function is a bijection, its output passes statistical tests of random numbers for successive inputs,
+  so it's used as the final step of hashes and as the output of random generators, which add @ref golden_gamma to
+  their states.
+  @param x Number.
+  @return Mixed number. */
+  [[nodiscard]] inline uint64_t mix64(uint64_t x) noexcept {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  /*! Returns key of a random stream of splitmix64 generator.
+  @details The k-th number of the stream is @ref mix64 of the key plus k times @ref golden_gamma. Streams of one seed
+  have unrelated keys, the stream 0 uses the seed itself.
+  @param s Seed.
+  @param n Number of the stream.
+  @return Key of the stream. */
+  [[nodiscard]] inline uint64_t streamKey(uint64_t s, uint64_t n) noexcept {
+    return s ^ mix64(n * golden_gamma);
+  }
+
+} // namespace
+
+
+#endif // SPLITMIX_HPP
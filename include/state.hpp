@@ -18,7 +18,8 @@ namespace des {
 
   /*! Class of a DES state corresponding a Petri net place.
   @details This class contains activity token quantity (quantity of tokens in corresponding Petri net place) and view
-  properties. */
+  properties. View properties are needed by editors only, so they are kept in @ref ColdStorage and the state itself
+  takes two words. */
   class State {
   public:
 
@@ -51,10 +52,10 @@ namespace des {
       return _activity;
     }
 
-    /*! Returns view properties of the state.
+    /*! Returns view properties of the state, they are allocated at the first call.
     @return Reference to the state view properties. */
-    inline ViewProperties& viewProperties() noexcept {
-      return _properties;
+    inline ViewProperties& viewProperties() {
+      return _properties.get();
     }
 
     /*! Returns true for equal @ref State object.
@@ -65,8 +66,8 @@ namespace des {
 
   protected:
 
-    unsigned _activity;                       ///< Quantity of activity tokens in state.
-    ViewProperties _properties;               ///< View properties of state.
+    unsigned _activity;                         ///< Quantity of activity tokens in state.
+    ColdStorage<ViewProperties> _properties;    ///< View properties of state.
 
   }; // State class
 
@@ -0,0 +1,151 @@
+/*! @file state_class_graph.hpp
+@ref des::StateClassGraph class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef STATE_CLASS_GRAPH_HPP
+#define STATE_CLASS_GRAPH_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "compiled_net.hpp"
+#include "marking_store.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Upper bound of time interval without limit, sums of two bounds don't overflow. */
+  const int64_t time_infinity = INT64_MAX / 4;
+
+  /*! Structure of static firing interval of event.
+  @details Bounds are integer units of model time, rational bounds should be scaled by a common denominator. An event
+  ready at time 0 can't fire before @ref Earliest and must fire or be disabled until @ref Latest. */
+  struct TimeInterval {
+    int64_t Earliest = 0;            ///< Earliest firing time.
+    int64_t Latest = time_infinity;  ///< Latest firing time or @ref time_infinity.
+
+    /*! Returns true for equal intervals. */
+    [[nodiscard]] inline bool operator==(const TimeInterval& i) const noexcept {
+      return Earliest == i.Earliest && Latest == i.Latest;
+    }
+  };
+
+  /*! Enumeration of boundedness verdicts of timed net. */
+  enum class Boundedness {
+    bounded,   ///< The state class graph is finite, so the net is bounded.
+    unbounded, ///< The sufficient condition of unboundedness holds.
+    unknown    ///< The exploration is stopped by a limit.
+  };
+
+  /*! Structure of state class graph options.
+  @details @ref Intervals contains static firing intervals of events ordered by event index, absent intervals are
+  [0, @ref time_infinity). Zero @ref MaxClasses means no limit. */
+  struct StateClassOptions {
+    std::vector<TimeInterval> Intervals = {}; ///< Static firing intervals of events.
+    size_t MaxClasses = 0;                    ///< Limit of state classes.
+  };
+
+  /*! Structure of state class graph result.
+  @details Deadlocks are classes without ready events, so they are reachable under timing constraints. */
+  struct StateClassResult {
+    bool Complete = false;                        ///< True for exhaustively explored graph.
+    Boundedness Bounded = Boundedness::unknown;   ///< Verdict of boundedness.
+    size_t Classes = 0;                           ///< Quantity of state classes.
+    size_t Markings = 0;                          ///< Quantity of distinct markings of classes.
+    size_t Edges = 0;                             ///< Quantity of firings between classes.
+    size_t Deadlocks = 0;                         ///< Quantity of classes without ready events.
+    Marking Bounds = {};                          ///< Max token quantity of each state over classes.
+    std::vector<size_t> DeadlockPath = {};        ///< Shortest firing sequence to a deadlock or empty sequence.
+  };
+
+  /*! Class of a state class graph of time Petri net.
+  @details This class builds the state class graph of Berthomieu and Diaz for a @ref CompiledNet with static firing
+  intervals of events. A state class is a marking with a firing domain: the set of possible times until firing of
+  ready events, which is kept as a difference bound matrix (DBM) over these times. The graph is explored
+  breadth-first. An event fires from a class, if it can be the earliest one, the successor domain is computed in
+  quadratic time from the canonical DBM, newly enabled events get their static intervals. The successor DBM is
+  canonical by construction, so equal classes have equal matrices: classes are stored in one array of matrices
+  without diagonals and found by hashing of their markings and matrices. Markings are kept in @ref MarkingStore. The
+  exploration stops with @ref Boundedness::unbounded, if a class has an ancestor with the same domain, less marking
+  and more tokens only in states, that have more tokens than any input link of events needs. */
+  class StateClassGraph {
+  public:
+
+    /*! Number of absent class. */
+    static const size_t none = UINT32_MAX;
+
+    /*! Constructs an empty @ref StateClassGraph object for specified net.
+    @param n Compiled net, it must outlive the graph.
+    @param o Options of the graph.
+    @throw std::invalid_argument Quantity of intervals exceeds quantity of events or an interval is invalid. */
+    explicit StateClassGraph(const CompiledNet& n, const StateClassOptions& o = {});
+
+    /*! Builds the graph from the initial class.
+    @return Result of the exploration.
+    @throw std::length_error Quantity of classes exceeds 32-bit numbers. */
+    StateClassResult build();
+
+    /*! Returns quantity of classes.
+    @return Quantity of classes. */
+    [[nodiscard]] inline size_t size() const noexcept {
+      return _parents.size();
+    }
+
+    /*! Copies marking of class.
+    @param i Number of class.
+    @param m Marking. */
+    void getMarking(size_t i, Marking& m) const;
+
+    /*! Returns interval of time until firing of event in class.
+    @param i Number of class.
+    @param t Index of event.
+    @return Firing interval.
+    @throw std::out_of_range The event isn't ready in the class. */
+    [[nodiscard]] TimeInterval getFiringInterval(size_t i, size_t t) const;
+
+    /*! Returns event indexes fired from the initial class to specified class.
+    @param i Number of class.
+    @return Firing sequence. */
+    [[nodiscard]] std::vector<size_t> getPath(size_t i) const;
+
+  private:
+
+    /*! Adds class with the marking number and the DBM of @ref _next into the graph, if it's absent.
+    @return Number of the class and true, if the class is added, or @ref none, if the limit of classes is reached. */
+    std::pair<size_t, bool> insert(size_t m, size_t dimension, size_t p, size_t e);
+
+    /*! Returns hash of class. */
+    [[nodiscard]] uint64_t hash(size_t m, const int64_t* d, size_t s) const noexcept;
+
+    /*! Returns true, if the class is a witness of unboundedness with one of its ancestors. */
+    [[nodiscard]] bool unbounded(size_t i) const;
+
+    /*! Doubles the hash table. */
+    void grow();
+
+    const CompiledNet& _net;                   ///< Analysed net.
+    StateClassOptions _options;                ///< Options of the graph.
+    std::vector<unsigned> _max_inputs;         ///< Max multiplicities of input links from states.
+    MarkingStore _markings;                    ///< Markings of classes.
+    std::vector<uint32_t> _class_markings;     ///< Numbers of markings of classes.
+    std::vector<uint32_t> _parents;            ///< Numbers of parent classes.
+    std::vector<uint32_t> _events;             ///< Indexes of events fired from parent classes.
+    std::vector<uint64_t> _offsets;            ///< Offsets of DBMs of classes in @ref _bounds.
+    std::vector<int64_t> _bounds;              ///< DBMs of all classes without diagonals, row by row.
+    std::vector<uint32_t> _table;              ///< Hash table of class numbers plus one, zero is empty slot.
+    std::vector<uint32_t> _ready;              ///< Buffer of ready events of explored class.
+    std::vector<uint32_t> _next_ready;         ///< Buffer of ready events of successor class.
+    std::vector<uint32_t> _positions;          ///< Variables of ready events in DBM of explored class, zero for others.
+    std::vector<int64_t> _minima;              ///< Buffer of min bounds of DBM columns.
+    std::vector<int64_t> _current;             ///< Buffer of full DBM of explored class.
+    std::vector<int64_t> _next;                ///< Buffer of full DBM of successor class.
+
+  }; // StateClassGraph class
+
+} // namespace
+
+
+#endif // STATE_CLASS_GRAPH_HPP
@@ -0,0 +1,170 @@
+/*! @file stochastic_simulator.hpp
+@ref des::StochasticSimulator class header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef STOCHASTIC_SIMULATOR_HPP
+#define STOCHASTIC_SIMULATOR_HPP
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "compiled_net.hpp"
+
+
+// Namespace of DES model.
+namespace des {
+
+  /*! Enumeration of distributions of firing delays. */
+  enum class DelayType {
+    exponential,   ///< Exponential delay with @ref FiringDelay::Rate.
+    deterministic, ///< Constant delay @ref FiringDelay::Value, zero for immediate events.
+    uniform,       ///< Uniform delay from @ref FiringDelay::Min to @ref FiringDelay::Max.
+    general        ///< Delay computed by @ref FiringDelay::Quantile from uniform random number.
+  };
+
+  /*! Structure of firing delay of event.
+  @details Only fields of the delay type are used. The quantile function (inverse distribution function) of general
+  delay gets a number from the open interval (0, 1) and must return a non-negative delay. */
+  struct FiringDelay {
+    DelayType Type = DelayType::exponential;            ///< Distribution of the delay.
+    double Rate = 1.0;                                  ///< Rate of exponential delay.
+    double Value = 0.0;                                 ///< Value of deterministic delay.
+    double Min = 0.0;                                   ///< Lower bound of uniform delay.
+    double Max = 0.0;                                   ///< Upper bound of uniform delay.
+    std::function<double(double)> Quantile = nullptr;  ///< Quantile function of general delay.
+  };
+
+  /*! Structure of stochastic simulation options.
+  @details @ref Delays contains firing delays of events ordered by event index, absent delays are exponential with
+  rate 1. The seed and the stream define random delays like in @ref SimulatorOptions. */
+  struct StochasticSimulatorOptions {
+    std::vector<FiringDelay> Delays = {}; ///< Firing delays of events.
+    uint64_t Seed = 0;                    ///< Seed of random delays.
+    uint64_t Stream = 0;                  ///< Number of random stream for the seed.
+  };
+
+  /*! Structure of stochastic simulation result.
+  @details Throughputs are quantities of firings of events per unit of model time. Occupancy statistics are averaged
+  over model time: @ref MeanTokens are mean token quantities of states, @ref BusyShares are shares of time with at
+  least one token in states. */
+  struct StochasticResult {
+    uint64_t Steps = 0;                     ///< Quantity of fired events.
+    double Time = 0.0;                      ///< Model time of the simulation end.
+    bool Deadlock = false;                  ///< True, if the simulation stopped in a marking without ready events.
+    std::vector<double> Throughputs = {};   ///< Throughputs of events ordered by event index.
+    std::vector<double> MeanTokens = {};    ///< Mean token quantities of states ordered by state index.
+    std::vector<double> BusyShares = {};    ///< Shares of time with tokens of states ordered by state index.
+    double Seconds = 0.0;                   ///< Wall-clock time of the simulation.
+    double FiringsPerSecond = 0.0;          ///< Quantity of fired events per second of wall-clock time.
+  };
+
+  /*! Class of a discrete-event simulator of stochastic Petri net.
+  @details This class simulates a @ref CompiledNet with random firing delays of events. An event gets its firing time
+  when it becomes ready, the earliest scheduled event fires, an event that stays ready after its firing gets a new
+  firing time, and an event that stops being ready loses its firing time (race policy with enabling memory and
+  single-server semantics). Ready events are tracked incrementally like in @ref Simulator, so a firing touches only
+  events consuming from changed states. Firing times are kept in an indexed binary heap: each event knows its position
+  in the heap, so its time is inserted, changed or removed in logarithmic time without search. Occupancy sums of
+  states are updated only on their changes. */
+  class StochasticSimulator {
+  public:
+
+    /*! Index of absent event. */
+    static const size_t none = UINT32_MAX;
+
+    /*! Constructs a @ref StochasticSimulator object in the initial marking of the net.
+    @param n Compiled net, it must outlive the simulator.
+    @param o Options of simulation.
+    @throw std::invalid_argument Quantity of delays exceeds quantity of events or a delay has invalid parameters. */
+    explicit StochasticSimulator(const CompiledNet& n, const StochasticSimulatorOptions& o = {});
+
+    /*! Returns the simulator into the initial marking at zero time, resets statistics and random delays. */
+    void reset();
+
+    /*! Fires the earliest scheduled event.
+    @return Index of the fired event or @ref none, if there are no ready events. */
+    size_t step();
+
+    /*! Fires events until specified quantity of steps, the time horizon or a deadlock.
+    @details The time of the result is the horizon, if the next firing time exceeds it.
+    @param n Max quantity of steps.
+    @param h Time horizon.
+    @return Result of the simulation since construction or reset. */
+    StochasticResult run(uint64_t n, double h = std::numeric_limits<double>::infinity());
+
+    /*! Returns the current model time.
+    @return Time of the last firing. */
+    [[nodiscard]] inline double getTime() const noexcept {
+      return _time;
+    }
+
+    /*! Returns the current marking.
+    @return Token quantities of states ordered by state index. */
+    [[nodiscard]] inline const Marking& getMarking() const noexcept {
+      return _marking;
+    }
+
+    /*! Returns quantity of scheduled (ready) events.
+    @return Quantity of events. */
+    [[nodiscard]] inline size_t getReadyQuantity() const noexcept {
+      return _heap.size();
+    }
+
+    /*! Returns firing time of scheduled event.
+    @param t Index of event.
+    @return Firing time or infinity for event, that isn't ready. */
+    [[nodiscard]] double getFiringTime(size_t t) const noexcept;
+
+  private:
+
+    /*! Structure of heap item. */
+    struct Scheduled {
+      double Time = 0.0;   ///< Firing time.
+      uint32_t Event = 0;  ///< Index of event.
+    };
+
+    /*! Returns random number from the open interval (0, 1). */
+    inline double uniform() noexcept;
+
+    /*! Returns random delay of event. */
+    inline double delay(uint32_t t);
+
+    /*! Adds event into the heap. */
+    inline void schedule(uint32_t t);
+
+    /*! Removes event from the heap. */
+    inline void cancel(uint32_t t);
+
+    /*! Moves heap item towards the root to its place and updates positions. */
+    inline void siftUp(size_t p) noexcept;
+
+    /*! Moves heap item towards leaves to its place and updates positions. */
+    inline void siftDown(size_t p) noexcept;
+
+    /*! Changes token quantity of state, updates occupancy sums and ready events consuming from it. */
+    inline void change(uint32_t s, unsigned q);
+
+    const CompiledNet& _net;                  ///< Simulated net.
+    StochasticSimulatorOptions _options;      ///< Options of simulation.
+    Marking _marking;                         ///< Current marking.
+    std::vector<uint32_t> _missing;           ///< Quantities of unsatisfied input links of events.
+    std::vector<Scheduled> _heap;             ///< Binary heap of firing times of ready events.
+    std::vector<uint32_t> _positions;         ///< Positions of events in the heap.
+    std::vector<uint64_t> _firings;           ///< Quantities of firings of events.
+    std::vector<double> _token_sums;          ///< Integrals of token quantities of states over time.
+    std::vector<double> _busy_sums;           ///< Time with tokens of states.
+    std::vector<double> _changes;             ///< Times of the last changes of states.
+    double _time = 0.0;                       ///< Model time.
+    uint64_t _steps = 0;                      ///< Quantity of fired events.
+    uint64_t _key = 0;                        ///< Key of the random stream.
+    uint64_t _counter = 0;                    ///< Counter of random numbers.
+
+  }; // StochasticSimulator class
+
+} // namespace
+
+
+#endif // STOCHASTIC_SIMULATOR_HPP
@@ -9,6 +9,32 @@
 
 using namespace std;
 
+//Вывод результата анализа со свидетельствами нарушений
+void print_result(const des::AnalysisResult& result) {
+    cout << "alive " << des::toString(result.Alive) << endl;
+    cout << "coherent " << des::toString(result.Coherent) << endl;
+    cout << "reachable " << des::toString(result.Reachable) << endl;
+    cout << "safe " << des::toString(result.Safe) << endl;
+    if (result.Deadlock) {	//путь к терминальной маркировке
+        cout << "deadlock trace:";
+        for (const auto& e : result.Deadlock->Events)
+            cout << " " << e;
+        cout << endl;
+    }
+    if (result.Unbounded) {	//путь к маркировке с неограниченными позициями
+        cout << "unbounded trace:";
+        for (const auto& e : result.Unbounded->Events)
+            cout << " " << e;
+        cout << endl;
+    }
+    if (!result.DeadEvents.empty()) {	//переходы, которые ни разу не сработали
+        cout << "dead events:";
+        for (const auto& e : result.DeadEvents)
+            cout << " " << e;
+        cout << endl;
+    }
+}
+
 
 int main() {
     try {
@@ -60,14 +86,9 @@ int main() {
 
         Analyser an;
 
-        map <string, bool> result;
 
         cout << "ANALYSIS RESULT №1" << endl;
-        result = an.run_analyse(exp1);
-
-      for (const auto& s : result) {
-            cout<< s.first << " " << s.second << endl;
-        }
+        print_result(an.run_analyse(exp1));
 
         des::Automation exp2;
         exp2.addState("p1", 1);
@@ -93,14 +114,10 @@ int main() {
         exp2.setLinkFromStateToEvent("p5", "t5", 1);
         exp2.setLinkFromEventToState("t5", "p1", 1);
         cout<< "ANALYSIS RESULT №2"<< endl;
-        map <string, bool> result2;
 
 
 
-        result2 = an.run_analyse(exp2);
-        for (const auto& s : result2) {
-            cout<< s.first << " " << s.second << endl;
-        }
+        print_result(an.run_analyse(exp2));
 
         des::Automation exp3;
         exp3.addState("p1", 1);
@@ -127,11 +144,7 @@ int main() {
 
         cout<< "ANALYSIS RESULT №3"<< endl;
 
-        map <string, bool> result3;
-        result3 = an.run_analyse(exp3);
-        for (const auto& s : result3) {
-            cout<< s.first << " " << s.second << endl;
-        }
+        print_result(an.run_analyse(exp3));
 
         des::Automation exp4;
         exp4.addState("p1", 1);
@@ -158,11 +171,7 @@ int main() {
         exp4.setLinkFromEventToState("t4", "p1", 1);
         cout<< "ANALYSIS RESULT №4"<< endl;
 
-        map <string, bool> result4;
-        result4 = an.run_analyse(exp4);
-        for (const auto& s : result4) {
-            cout<< s.first << " " << s.second << endl;
-        }
+        print_result(an.run_analyse(exp4));
 
 
         des::Automation exp5;
@@ -206,11 +215,7 @@ int main() {
         exp5.setLinkFromEventToState("t1", "p1", 1);
 
         cout<< "ANALYSIS RESULT №5"<< endl;
-        map <string, bool> result5;
-        result5 = an.run_analyse(exp5);
-        for (const auto& s : result5) {
-            cout<< s.first << " " << s.second << endl;
-        }
+        print_result(an.run_analyse(exp5));
 
 
 
@@ -243,12 +248,8 @@ int main() {
         exp12.setLinkFromStateToEvent("p5", "t4", 1);
         exp12.setLinkFromEventToState("t4", "p4", 1);
 
-        map <string, bool> result12;
         cout<< "ANALYSIS RESULT №6"<< endl;
-        result12 = an.run_analyse(exp12);
-        for (const auto& s : result12) {
-            cout<< s.first << " " << s.second << endl;
-        }
+        print_result(an.run_analyse(exp12));
 
         des::Automation exp13;  
         exp13.addState("p1", 1);
@@ -280,12 +281,8 @@ int main() {
         exp13.setLinkFromStateToEvent("p4", "t6", 1);
         exp13.setLinkFromEventToState("t6", "p1", 1);
 
-        map <string, bool> result13;
         cout<< "ANALYSIS RESULT №7"<< endl;
-        result13 = an.run_analyse(exp13);
-        for (const auto& s : result13) {
-            cout<< s.first << " " << s.second << endl;
-        }
+        print_result(an.run_analyse(exp13));
         des::Automation exp14;  
         exp14.addState("p1", 2);
         exp14.addState("p2", 1);
@@ -314,12 +311,8 @@ int main() {
         exp14.setLinkFromStateToEvent("p4", "t4", 1);
         exp14.setLinkFromEventToState("t4", "p6", 1);
 
-        map <string, bool> result14;
         cout<< "ANALYSIS RESULT №8"<< endl;
-        result14 = an.run_analyse(exp14);
-        for (const auto& s : result14) {
-            cout<< s.first << " " << s.second << endl;
-        }
+        print_result(an.run_analyse(exp14));
 
         des::Automation exp15;  
         exp15.addState("p1", 1);
@@ -352,12 +345,8 @@ int main() {
         exp15.setLinkFromEventToState("t5", "p8", 1);
         exp15.setLinkFromEventToState("t4", "p7", 1);
 
-        map <string, bool> result15;
         cout<< "ANALYSIS RESULT №9"<< endl;
-        result15 = an.run_analyse(exp15);
-        for (const auto& s : result15) {
-            cout<< s.first << " " << s.second << endl;
-        }
+        print_result(an.run_analyse(exp15));
 
 
 
@@ -386,12 +375,8 @@ int main() {
 
         exp16.setLinkFromEventToState("t3", "p5", 1);
 
-        map <string, bool> result16;
                 cout<< "ANALYSIS RESULT №10"<< endl;
-                result16 = an.run_analyse(exp16);
-                for (const auto& s : result16) {
-                    cout<< s.first << " " << s.second << endl;
-                }
+                print_result(an.run_analyse(exp16));
 
     }
 
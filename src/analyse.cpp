@@ -1,8 +1,14 @@
 ﻿#include <typeinfo>
+#include <chrono>
+#include <iterator>
+#include <thread>
+#include <atomic>
+#include <exception>
 #include "analyse.hpp"
+#include "result_cache.hpp"
 using namespace std;
 
-set<string> getPotReadyEvents(des::Automation& model, map <string, int> mark){
+set<string> getPotReadyEvents(const des::Automation& model, map <string, int> mark){
     
     set<string> result = {};							//множество, в котором будут храниться переходы, готовые сработать
     
@@ -27,7 +33,7 @@ set<string> getPotReadyEvents(des::Automation& model, map <string, int> mark){
 }
 
 
-map <string, int> potFire(des::Automation& model, map <string, int> mark, string e){
+map <string, int> potFire(const des::Automation& model, map <string, int> mark, string e){
     
     map<string, int> new_mark= mark;						//В переменную new_mark записываем значение данной маркировки.
     set<string> result = getPotReadyEvents(model, mark);	//В множество result записываем все переходы, готовые сработать.
@@ -97,27 +103,44 @@ Node::Node(Node* par, map<string, int> d) {
 
 
 //Метод обработки одного узла дерева
-void Analyser::analyse_node(Node* start, des::Automation& model) {
+void Analyser::analyse_node(Node* start, const des::Automation& model, AnalysisContext& context) const {
     map<string, int> next;		//Создаем словарь next, в котором будет храниться имя состояния и количество токенов активности.
     const auto& ready_events = getPotReadyEvents(model, start->data);	//В словарь ready_events записываем все возможные события для данного узла модели
     
     if (ready_events.empty()) {	//Если пуст словарь ready_events,
-       	term++;					//увеличиваем счетчик терминальных вершин term дерева.
+       	context.term++;					//увеличиваем счетчик терминальных вершин term дерева.
+        if (!context.deadlock_node)		//Запоминаем первую терминальную вершину для восстановления пути к ней
+            context.deadlock_node = start;
     }
     else {	//Иначе
         for (const auto& elem : ready_events) {			//Для каждого элемента в словаре ready_events
             next = potFire(model, start->data, elem);	//записываем в словарь next маркировку.
-            done_events.insert(elem);					//В контейнер done_events записываем текущий элемент elem, который является отработанным переходом, из списка полученных ready_events
+            context.done_events.insert(elem);					//В контейнер done_events записываем текущий элемент elem, который является отработанным переходом, из списка полученных ready_events
             Node next_node(start, next);				//Создаем следующий узел
+            next_node.event = lower_bound(context.event_names.begin(), context.event_names.end(), elem) - context.event_names.begin();	//и запоминаем сработавший переход
 
-            if (close.find(next_node.data) == close.end() && start->data != next_node.data) {	//Если вершина с параметрами узла next_node уже содержится в контейнере закрытых вершин, и не равна начальной вершине
-                open.insert(next_node.data);	//В множество открытых вершин записываем следующую вершину с параметрами next_node.
-                int sizetr = tree.size();		//В целочисленную переменную sizetr записываем текущий размер дерева.
-                tree[sizetr]=next_node;			//Записываем в дерево следующую вершину с параметрами next_node
+            if (context.close.find(next_node.data) == context.close.end() && start->data != next_node.data) {	//Если вершина с параметрами узла next_node уже содержится в контейнере закрытых вершин, и не равна начальной вершине
+                context.open.insert(next_node.data);	//В множество открытых вершин записываем следующую вершину с параметрами next_node.
+                int sizetr = context.tree.size();		//В целочисленную переменную sizetr записываем текущий размер дерева.
+                context.tree[sizetr]=next_node;			//Записываем в дерево следующую вершину с параметрами next_node
+                for (const auto& pair : next_node.data) {	//Считаем вершины с неограниченными позициями
+                    if (pair.second == -1) {
+                        context.omega_nodes++;
+                        if (!context.omega_node)		//Запоминаем первую из них для восстановления пути к ней
+                            context.omega_node = &(context.tree[sizetr]);
+                        break;
+                    }
+                }
+                if (context.exporter) {	//Выгружаем новую вершину и дугу к ней
+                    context.exporter->addNode(sizetr, next_node.data);
+                    context.exporter->addEdge(context.current, sizetr, elem);
+                }
             }
             else {	//Иначе
-                if(tree[0].data == next_node.data)	//если параметры следующего узла равны параметрам начальной вершины дерева
-                  dubl_start++;						//увеличиваем счетчик дублирующих начальную вершин
+                if(context.tree[0].data == next_node.data)	//если параметры следующего узла равны параметрам начальной вершины дерева
+                  context.dubl_start++;						//увеличиваем счетчик дублирующих начальную вершин
+                if (context.exporter)	//Дуга к обрабатываемой или закрытой вершине
+                    context.exporter->addEdge(context.current, start->data == next_node.data ? context.current : context.close.find(next_node.data)->second, elem);
             }
         }
     }
@@ -126,7 +149,13 @@ void Analyser::analyse_node(Node* start, des::Automation& model) {
 
 //Проверка сети Петри на связность
 
-int Analyser::bfs(des::Automation& model){
+int Analyser::bfs(const des::Automation& model) const {
+    set <string> unvisited;
+    return bfs(model, unvisited);
+}
+
+//Проверка сети Петри на связность с множеством недостижимых вершин
+int Analyser::bfs(const des::Automation& model, set<string>& unvisited) const {
     set <string> visited;
     vector <string> queue;
     set <string> states = model.getStateNameSet();
@@ -155,6 +184,8 @@ int Analyser::bfs(des::Automation& model){
             }
         }
     }
+    unvisited.clear();
+    set_difference(points.begin(), points.end(), visited.begin(), visited.end(), inserter(unvisited, unvisited.end()));
     if (visited != points){
         return 0;
         }
@@ -163,55 +194,194 @@ int Analyser::bfs(des::Automation& model){
     }
 }
 
+//Оценка объема памяти, занимаемой одной вершиной дерева или множества
+size_t node_memory(const map<string, int>& mark) {
+    size_t result = sizeof(Node) + 4 * sizeof(void*);	//узел контейнера
+    for (const auto& pair : mark) {						//для каждой позиции маркировки
+        result += sizeof(pair) + 4 * sizeof(void*);		//узел словаря маркировки
+        if (pair.first.capacity() > 15)					//и строка, не поместившаяся в сам объект
+            result += pair.first.capacity() + 1;
+    }
+    return result;
+}
+
+//Проверка ограничений анализа
+des::AnalysisStatus check_limits(const des::AnalysisOptions& options, const des::AnalysisStatistics& stat, chrono::steady_clock::time_point start) {
+    if (options.Cancellation && options.Cancellation->isCancelled())
+        return des::AnalysisStatus::cancelled;
+    if (options.MaxStates && stat.States >= options.MaxStates)
+        return des::AnalysisStatus::stateLimit;
+    if (options.MaxMemory && stat.Memory > options.MaxMemory)
+        return des::AnalysisStatus::memoryLimit;
+    if (options.TimeLimit.count() && (stat.States & 63) == 0 && chrono::steady_clock::now() - start > options.TimeLimit)	//время проверяем не на каждой вершине
+        return des::AnalysisStatus::timeLimit;
+    return des::AnalysisStatus::complete;
+}
+
+//Заполнение статистики для функции обратного вызова
+des::AnalysisProgress make_progress(const des::AnalysisStatistics& stat, Node* current, int omega_nodes, chrono::steady_clock::duration elapsed) {
+    des::AnalysisProgress progress;
+    progress.States = stat.States;
+    progress.Frontier = stat.Frontier;
+    progress.Memory = stat.Memory;
+    progress.OmegaNodes = omega_nodes;
+    progress.Elapsed = chrono::duration_cast<chrono::milliseconds>(elapsed);
+    const double seconds = chrono::duration<double>(elapsed).count();
+    if (seconds > 0)
+        progress.StatesPerSecond = stat.States / seconds;
+    for (Node* p = current; p && p->parent; p = p->parent)	//глубина - количество предков вершины
+        progress.Depth++;
+    return progress;
+}
+
+//Восстановление последовательности срабатываний от начальной вершины по родительским ссылкам
+des::Witness Analyser::witness(const Node* node, const AnalysisContext& context) const {
+    des::Witness result;
+    for (const auto& pair : node->data)		//Маркировка вершины, -1 соответствует неограниченной позиции
+        result.Marking[pair.first] = pair.second == -1 ? des::omega : pair.second;
+    for (const Node* p = node; p && p->parent; p = p->parent)
+        result.Events.push_back(context.event_names[p->event]);
+    reverse(result.Events.begin(), result.Events.end());
+    return result;
+}
+
 //Функция анализа сети Петри
-map<string, bool> Analyser::run_analyse(des::Automation& model) {
+des::AnalysisResult Analyser::run_analyse(const des::Automation& model, const des::AnalysisOptions& options) const {
 
+    AnalysisContext context;	//рабочее состояние вызова, освобождается при выходе в том числе по исключению
+
+    const auto started = chrono::steady_clock::now();	//время начала анализа
+    const des::Fingerprint fingerprint = options.Cache ? model.fingerprint() : des::Fingerprint();	//ключ кэша результатов
+    if (options.Cache && !options.Exporter) {	//Если сеть с такими ограничениями уже анализировалась, возвращаем сохраненный результат
+        if (auto cached = options.Cache->find(fingerprint, options)) {
+            if (options.Progress)
+                options.Progress(make_progress(cached->Statistics, nullptr, static_cast<int>(cached->Statistics.OmegaNodes), chrono::steady_clock::now() - started));
+            return *cached;
+        }
+    }
+    des::AnalysisResult result;	//результат анализа со статистикой
     int i=0;	//счетчик, по умолчанию равный 0
-    map<string, bool> analysis_result {{"alive", 0},{"coherent", 0},{"safe", 0},{"reachable",0}};	//Словарь, который и будет возвращать данная функция анализа сети Петри, и в котором содержатся пары ключ-значение, соответствующие характеристикам сети Петри
     map<string, int> mark;	//Словарь mark, в котором будет храниться маркировка в виде ключ-значение
     set <string> all_events = model.getEventNameSet();	//Контейнер, в котором хранятся все возможные события (переходы) для данной сети Петри
+    context.event_names.assign(all_events.begin(), all_events.end());	//Номера переходов для родительских ссылок
 
     for (const auto& s : model.getStateNameSet()) {	//Для всех состояний сети Петри
         mark[s] = model.getActivity(s);				//записываем в mark количество токенов активности
     }
     Node start(mark);	//Создаем начальную маркировку start как объект класса Node.
 
-    tree[0] = start;	//В начальную вершину дерева tree записываем начальную маркировку.
-    open.insert(start.data);	//Заносим начальную маркировку в множество открытых вершин.
+    context.tree[0] = start;	//В начальную вершину дерева tree записываем начальную маркировку.
+    context.open.insert(start.data);	//Заносим начальную маркировку в множество открытых вершин.
+    context.exporter = options.Exporter;
+    if (context.exporter)	//Начальная вершина графа достижимости
+        context.exporter->addNode(0, start.data);
+
+    const size_t node_size = node_memory(mark);	//Оценка памяти одной вершины
+    auto next_report = started + options.ProgressInterval;	//время следующего вызова функции обратного вызова
 
-    while (open.size()!=0) {	//Пока размер контейнера открытых вершин не равен 0
-            analyse_node(&(tree[i]), model);	//Анализируем i-ую вершину дерева в методе analyse_node.
-            close.insert((tree[i]).data);		//Заносим i-ую вершину дерева в множество закрытых вершин дерева.
-            open.erase((tree[i]).data);			//Из множества открытых вершин стираем i-ую вершину дерева.
+    while (context.open.size()!=0) {	//Пока размер контейнера открытых вершин не равен 0
+            result.Statistics.States = i;
+            result.Statistics.Memory = (context.tree.size() + context.open.size() + context.close.size()) * node_size;
+            result.Statistics.PeakMemory = max(result.Statistics.PeakMemory, result.Statistics.Memory);
+            result.Status = check_limits(options, result.Statistics, started);
+            if (result.Status != des::AnalysisStatus::complete)	//Если сработало ограничение, прерываем построение дерева
+                break;
+            if (options.Progress && (i & 63) == 0) {	//Без функции обратного вызова часы не читаем
+                const auto now = chrono::steady_clock::now();
+                if (now >= next_report) {
+                    result.Statistics.Frontier = context.open.size();
+                    options.Progress(make_progress(result.Statistics, &(context.tree[i]), context.omega_nodes, now - started));
+                    next_report = now + options.ProgressInterval;
+                }
+            }
+            context.current = i;
+            analyse_node(&(context.tree[i]), model, context);	//Анализируем i-ую вершину дерева в методе analyse_node.
+            context.close.emplace((context.tree[i]).data, i);	//Заносим i-ую вершину дерева в множество закрытых вершин дерева.
+            context.open.erase((context.tree[i]).data);			//Из множества открытых вершин стираем i-ую вершину дерева.
             i++;								//Увеличиваем счетчик i 
         }
-    
+    const auto explored = chrono::steady_clock::now();	//время окончания построения дерева
+
+    result.Statistics.States = context.close.size();
+    result.Statistics.Frontier = context.open.size();
+    result.Statistics.TerminalStates = context.term;
+    result.Statistics.OmegaNodes = context.omega_nodes;
+    result.Statistics.Memory = (context.tree.size() + context.open.size() + context.close.size()) * node_size;
+    result.Statistics.PeakMemory = max(result.Statistics.PeakMemory, result.Statistics.Memory);
+    const bool complete = !result.inconclusive();	//Если дерево построено не полностью, определяем только решенные свойства
+
     //Проверка на живость   
-    if (term == 0 && (done_events.size() == all_events.size()))	//Если счетчик терминальных вершин равен 0 и размеры контейнеров done_events и all_events, содержащих соответственно все отработанные переходы и вообще все переходи сети Петри, равны между собой
-        analysis_result["alive"]=1;							//В словаре analysis_result меняем значение ключа alive на 1
-	
+    set_difference(all_events.begin(), all_events.end(), context.done_events.begin(), context.done_events.end(), inserter(result.DeadEvents, result.DeadEvents.end()));
+    if (context.term != 0)	//Если есть терминальная вершина, сеть не жива, путь к ней - свидетельство
+        result.Alive = des::Verdict::no;
+    else if (complete)	//Иначе сеть жива, если сработали все переходы
+        result.Alive = result.DeadEvents.empty() ? des::Verdict::yes : des::Verdict::no;
+    if (context.deadlock_node)
+        result.Deadlock = witness(context.deadlock_node, context);
+
 	//Проверка на достижимость
-    if (dubl_start != 0)				//Если счетчик вершин, дублирующих начальную, равен нулю
-        analysis_result["reachable"]=1;	//В словаре analysis_result меняем значение ключа reachable на 1
+    if (context.dubl_start != 0)				//Если счетчик вершин, дублирующих начальную, не равен нулю
+        result.Reachable = des::Verdict::yes;
+    else if (complete)
+        result.Reachable = des::Verdict::no;
 
     //Проверка на безопасность
-    analysis_result["safe"] = 1;
-    for (const auto& el : close){
-        for (const auto& pair: el){
-            if (pair.second == -1)
-                analysis_result["safe"] = 0;
-        }
+    if (context.omega_node) {	//Вершина с неограниченной позицией - свидетельство небезопасности
+        result.Safe = des::Verdict::no;
+        result.Unbounded = witness(context.omega_node, context);
     }
-    
-    //Проверка на ограниченность
-	analysis_result["coherent"] = bfs(model);
-	
-    open.clear();	//Очищаем множество открытых вершин
-    close.clear();	//Очищаем множество закрытых вершин.
-    term = 0;		//Обнуляем счетчик терминальных вершин.
-    tree.clear();	//Очищаем дерево.
-    dubl_start = 0;	//Обнуляем счетчик вершин, дублирующих начальную.
-    done_events.clear();	//Очищаем множество выполненных переходов.
-
-    return analysis_result;	//Возвращаем словарь analysis_result, в котором теперь записаны актуальные свойства данной сети Петри.
-    }
\ No newline at end of file
+    else if (complete)
+        result.Safe = des::Verdict::yes;
+    const auto checked = chrono::steady_clock::now();	//время окончания проверки свойств
+
+    //Проверка на связность
+    result.Coherent = bfs(model, result.Disconnected) ? des::Verdict::yes : des::Verdict::no;
+    const auto finished = chrono::steady_clock::now();
+
+    result.Timings.Exploration = chrono::duration_cast<chrono::microseconds>(explored - started);
+    result.Timings.Verdicts = chrono::duration_cast<chrono::microseconds>(checked - explored);
+    result.Timings.Connectivity = chrono::duration_cast<chrono::microseconds>(finished - checked);
+    result.Statistics.Duration = chrono::duration_cast<chrono::milliseconds>(finished - started);
+    if (options.Progress)	//Итоговая статистика
+        options.Progress(make_progress(result.Statistics, nullptr, context.omega_nodes, finished - started));
+    if (options.Cache)	//Детерминированный результат сохраняем в кэш
+        options.Cache->insert(fingerprint, options, result);
+
+    return result;	//Возвращаем результат, в котором теперь записаны актуальные свойства данной сети Петри.
+    }
+
+
+//Параллельный анализ нескольких сетей Петри
+//Сети распределяются между потоками через общий атомарный счетчик, каждый вызов run_analyse работает со своим контекстом.
+//Функция обратного вызова и токен отмены из options используются всеми потоками одновременно.
+vector<des::AnalysisResult> Analyser::run_batch(const vector<des::Automation>& models, const des::AnalysisOptions& options, unsigned threads) const {
+    vector<des::AnalysisResult> results(models.size());	//результаты в порядке сетей
+    vector<exception_ptr> errors(models.size());			//исключения анализа отдельных сетей
+    if (threads == 0)	//По умолчанию - по числу аппаратных потоков
+        threads = max(1u, thread::hardware_concurrency());
+    threads = static_cast<unsigned>(min<size_t>(threads, models.size()));
+    atomic<size_t> next(0);	//номер следующей сети для анализа
+
+    auto worker = [&]() {
+        for (size_t i = next++; i < models.size(); i = next++) {
+            try {
+                results[i] = run_analyse(models[i], options);
+            }
+            catch (...) {
+                errors[i] = current_exception();
+            }
+        }
+    };
+    vector<thread> pool;
+    for (unsigned t = 1; t < threads; t++)	//текущий поток тоже выполняет анализ
+        pool.emplace_back(worker);
+    if (threads)
+        worker();
+    for (auto& t : pool)
+        t.join();
+
+    for (const auto& e : errors)	//Первое исключение передаем вызывающему после завершения всех потоков
+        if (e)
+            rethrow_exception(e);
+    return results;
+}
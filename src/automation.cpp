@@ -9,8 +9,39 @@
 using namespace std;
 using namespace des;
 
+namespace {
+
+  // Replaces fingerprint of component, detached components aren't fingerprinted.
+  void replaceFingerprint(Fingerprint& f, const SharedDictionary<bool>& d, const string& n, const Fingerprint& o,
+    const Fingerprint& v) noexcept {
+    if (!d.find(n)) {
+      f -= o;
+      f += v;
+    }
+  }
+
+} // namespace
+
 // Constructor of des::Automation object.
-Automation::Automation() : _states(), _events() {
+Automation::Automation() : _states(), _events(), _journal() {
+}
+
+// Constructor of des::Automation object by copying.
+Automation::Automation(const Automation& a) : _states(a._states), _events(a._events), _fingerprint(a._fingerprint),
+  _detached_states(a._detached_states), _detached_events(a._detached_events), _journal(a._journal) {
+  ownDetached(a);
+}
+
+// Constructor of des::Automation object with memory resource.
+Automation::Automation(pmr::memory_resource* r) : _states(r), _events(r), _detached_states(r), _detached_events(r),
+  _journal(r) {
+}
+
+// Constructor of des::Automation object by copying into memory resource.
+Automation::Automation(const Automation& a, pmr::memory_resource* r) : _states(a._states, r), _events(a._events, r),
+  _fingerprint(a._fingerprint), _detached_states(a._detached_states, r), _detached_events(a._detached_events, r),
+  _journal(a._journal, r) {
+  ownDetached(a);
 }
 
 // State addition with creation.
@@ -18,11 +49,11 @@ void Automation::addState(const string& n, const unsigned& a) {
   if (!checkNameString(n)) {
     throw invalid_argument("addState: state name is invalid");
   }
-  if (_states.find(n) == _states.end()) {
-    _states.emplace(n, ComponentWithLinks(State(a)));
-  } else {
+  if (!_states.insert(n, ComponentWithLinks(State(a)))) {
     throw invalid_argument("addState: state name already exists");
   }
+  _fingerprint += fingerprintState(n, a);
+  record(ChangeKind::addState, n, "", a);
 }
 
 // State addition by copying.
@@ -30,10 +61,15 @@ void Automation::addState(const string& n, const State& s) {
   if (!checkNameString(n)) {
     throw invalid_argument("addState: state name is invalid");
   }
-  if (_states.find(n) == _states.end()) {
-    _states.emplace(n, ComponentWithLinks(s));
+  if (auto* state = _states.modify(n)) {
+    replaceFingerprint(_fingerprint, _detached_states, n, fingerprintState(n, state->Component.activity()),
+      fingerprintState(n, s.activity()));
+    state->Component = s;
+    record(ChangeKind::changeState, n, "", s.activity());
   } else {
-    _states.at(n).Component = s;
+    _states.insert(n, ComponentWithLinks(s));
+    _fingerprint += fingerprintState(n, s.activity());
+    record(ChangeKind::addState, n, "", s.activity());
   }
 }
 
@@ -42,17 +78,27 @@ void Automation::addState(const string& n, State&& s) {
   if (!checkNameString(n)) {
     throw invalid_argument("addState: state name is invalid");
   }
-  if (_states.find(n) == _states.end()) {
-    _states.emplace(n, ComponentWithLinks(std::move(s)));
+  const Fingerprint f = fingerprintState(n, s.activity());
+  const unsigned a = s.activity();
+  if (auto* state = _states.modify(n)) {
+    replaceFingerprint(_fingerprint, _detached_states, n, fingerprintState(n, state->Component.activity()), f);
+    state->Component = std::move(s);
+    record(ChangeKind::changeState, n, "", a);
   } else {
-    _states.at(n).Component = std::move(s);
+    _states.insert(n, ComponentWithLinks(std::move(s)));
+    _fingerprint += f;
+    record(ChangeKind::addState, n, "", a);
   }
 }
 
 // State getting by name.
 State& Automation::getState(const string& n) {
-  if (_states.find(n) != _states.end()) {
-    return _states.at(n).Component;
+  if (auto* state = _states.modify(n)) {
+    if (_detached_states.insert(n, true)) {
+      _fingerprint -= fingerprintState(n, state->Component.activity());
+    }
+    record(ChangeKind::changeState, n, "", state->Component.activity());
+    return state->Component;
   } else {
     throw invalid_argument("getState: state name doesn't exist");
   }
@@ -62,15 +108,18 @@ State& Automation::getState(const string& n) {
 set<string> Automation::getStateNameSet() const noexcept {
   std::set<std::string> result = {};
   for (const auto& s : _states) {
-    result.insert(s.first);
+    result.insert(result.end(), s.first);
   }
   return result;
 }
 
 // Change activity token quantity.
 void Automation::setActivity(const string& n, const unsigned int& a) {
-  if (checkState(n)) {
-    getState(n).setActivity(a);
+  if (auto* state = _states.modify(n)) {
+    replaceFingerprint(_fingerprint, _detached_states, n, fingerprintState(n, state->Component.activity()),
+      fingerprintState(n, a));
+    state->Component.setActivity(a);
+    record(ChangeKind::changeState, n, "", a);
   } else {
     throw invalid_argument("setActivity: state name doesn't exist");
   }
@@ -78,26 +127,22 @@ void Automation::setActivity(const string& n, const unsigned int& a) {
 
 // Quantity of input links of state.
 size_t Automation::getStateInputLinkQuantity(const string& n) const noexcept {
-  if (_states.find(n) != _states.end()) {
-    return _states.at(n).Inputs.size();
-  }
-  return 0;
+  const auto* state = _states.find(n);
+  return state ? state->Inputs.size() : 0;
 }
 
 // Quantity of output links of state.
 size_t Automation::getStateOutputLinkQuantity(const string& n) const noexcept {
-  if (_states.find(n) != _states.end()) {
-    return _states.at(n).Outputs.size();
-  }
-  return 0;
+  const auto* state = _states.find(n);
+  return state ? state->Outputs.size() : 0;
 }
 
 // Set of input event names.
 set<string> Automation::getStateInputs(const string& n) const noexcept {
   set<string> inputs = {};
-  if (checkState(n)) {
-    for (const auto& i : _states.at(n).Inputs) {
-      inputs.insert(i.first);
+  if (const auto* state = _states.find(n)) {
+    for (const auto& i : state->Inputs) {
+      inputs.insert(inputs.end(), i.first);
     }
   }
   return inputs;
@@ -106,24 +151,32 @@ set<string> Automation::getStateInputs(const string& n) const noexcept {
 // Set of output event names.
 set<string> Automation::getStateOutputs(const string& n) const noexcept {
   set<string> outputs = {};
-  if (checkState(n)) {
-    for (const auto& i : _states.at(n).Outputs) {
-      outputs.insert(i.first);
+  if (const auto* state = _states.find(n)) {
+    for (const auto& i : state->Outputs) {
+      outputs.insert(outputs.end(), i.first);
     }
   }
   return outputs;
 }
 
 // State deletion.
-void Automation::removeState(const string& n) noexcept {
-  if (_states.find(n) != _states.end()) {
-    for (const auto& event : _states.at(n).Inputs) {
-      _events.at(event.first).Outputs.erase(n);
+void Automation::removeState(const string& n) {
+  if (const auto* state = _states.find(n)) {
+    for (const auto& event : state->Inputs) {
+      _events.modify(event.first)->Outputs.erase(n);
+      _fingerprint -= fingerprintLink(n, event.first, false, event.second);
+      record(ChangeKind::setOutputLink, n, event.first, 0);
+    }
+    for (const auto& event : state->Outputs) {
+      _events.modify(event.first)->Inputs.erase(n);
+      _fingerprint -= fingerprintLink(n, event.first, true, event.second);
+      record(ChangeKind::setInputLink, n, event.first, 0);
     }
-    for (const auto& event : _states.at(n).Outputs) {
-      _events.at(event.first).Inputs.erase(n);
+    if (!_detached_states.erase(n)) {
+      _fingerprint -= fingerprintState(n, state->Component.activity());
     }
     _states.erase(n);
+    record(ChangeKind::removeState, n, "", 0);
   }
 }
 
@@ -132,11 +185,11 @@ void Automation::addEvent(const string& n, const EventType& t) {
   if (!checkNameString(n)) {
     throw invalid_argument("addEvent: event name is invalid");
   }
-  if (_events.find(n) == _events.end()) {
-    _events.emplace(n, ComponentWithLinks(Event(t)));
-  } else {
+  if (!_events.insert(n, ComponentWithLinks(Event(t)))) {
     throw invalid_argument("addEvent: event name already exists");
   }
+  _fingerprint += fingerprintEvent(n, t);
+  record(ChangeKind::addEvent, "", n, static_cast<unsigned>(t));
 }
 
 // Event addition by copying.
@@ -147,10 +200,15 @@ void Automation::addEvent(const string& n, const Event& e) {
   if (!checkMacroEvent(e)) {
     throw runtime_error("addEvent: masked events list of macro event is invalid");
   }
-  if (_events.find(n) == _events.end()) {
-    _events.emplace(n, ComponentWithLinks(e));
+  if (auto* event = _events.modify(n)) {
+    replaceFingerprint(_fingerprint, _detached_events, n, fingerprintEvent(n, event->Component.type()),
+      fingerprintEvent(n, e.type()));
+    event->Component = e;
+    record(ChangeKind::changeEvent, "", n, static_cast<unsigned>(e.type()));
   } else {
-    _events.at(n).Component = e;
+    _events.insert(n, ComponentWithLinks(e));
+    _fingerprint += fingerprintEvent(n, e.type());
+    record(ChangeKind::addEvent, "", n, static_cast<unsigned>(e.type()));
   }
 }
 
@@ -162,17 +220,27 @@ void Automation::addEvent(const string& n, Event&& e) {
   if (!checkMacroEvent(e)) {
     throw runtime_error("addEvent: masked events list of macro event is invalid");
   }
-  if (_events.find(n) == _events.end()) {
-    _events.emplace(n, ComponentWithLinks(std::move(e)));
+  const Fingerprint f = fingerprintEvent(n, e.type());
+  const auto t = static_cast<unsigned>(e.type());
+  if (auto* event = _events.modify(n)) {
+    replaceFingerprint(_fingerprint, _detached_events, n, fingerprintEvent(n, event->Component.type()), f);
+    event->Component = std::move(e);
+    record(ChangeKind::changeEvent, "", n, t);
   } else {
-    _events.at(n).Component = std::move(e);
+    _events.insert(n, ComponentWithLinks(std::move(e)));
+    _fingerprint += f;
+    record(ChangeKind::addEvent, "", n, t);
   }
 }
 
 // Event getting by name.
 Event& Automation::getEvent(const string &n) {
-  if (_events.find(n) != _events.end()) {
-    return _events.at(n).Component;
+  if (auto* event = _events.modify(n)) {
+    if (_detached_events.insert(n, true)) {
+      _fingerprint -= fingerprintEvent(n, event->Component.type());
+    }
+    record(ChangeKind::changeEvent, "", n, static_cast<unsigned>(event->Component.type()));
+    return event->Component;
   } else {
     throw invalid_argument("getEvent: event name doesn't exist");
   }
@@ -182,33 +250,29 @@ Event& Automation::getEvent(const string &n) {
 set<string> Automation::getEventNameSet() const noexcept {
   std::set<std::string> result = {};
   for (const auto& e : _events) {
-    result.insert(e.first);
+    result.insert(result.end(), e.first);
   }
   return result;
 }
 
 // Quantity of input links of event.
 size_t Automation::getEventInputLinksQuantity(const string& n) const noexcept {
-  if (_events.find(n) != _events.end()) {
-    return _events.at(n).Inputs.size();
-  }
-  return 0;
+  const auto* event = _events.find(n);
+  return event ? event->Inputs.size() : 0;
 }
 
 // Quantity of output links of event.
 size_t Automation::getEventOutputLinksQuantity(const string& n) const noexcept {
-  if (_events.find(n) != _events.end()) {
-    return _events.at(n).Outputs.size();
-  }
-  return 0;
+  const auto* event = _events.find(n);
+  return event ? event->Outputs.size() : 0;
 }
 
 // Set of input state names.
 set<string> Automation::getEventInputs(const string& n) const noexcept {
   set<string> inputs = {};
-  if (checkEvent(n)) {
-    for (const auto& i : _events.at(n).Inputs) {
-      inputs.insert(i.first);
+  if (const auto* event = _events.find(n)) {
+    for (const auto& i : event->Inputs) {
+      inputs.insert(inputs.end(), i.first);
     }
   }
   return inputs;
@@ -217,9 +281,9 @@ set<string> Automation::getEventInputs(const string& n) const noexcept {
 // Set of output state names.
 set<string> Automation::getEventOutputs(const string& n) const noexcept {
   set<string> outputs = {};
-  if (checkEvent(n)) {
-    for (const auto& i : _events.at(n).Outputs) {
-      outputs.insert(i.first);
+  if (const auto* event = _events.find(n)) {
+    for (const auto& i : event->Outputs) {
+      outputs.insert(outputs.end(), i.first);
     }
   }
   return outputs;
@@ -227,23 +291,31 @@ set<string> Automation::getEventOutputs(const string& n) const noexcept {
 
 // Type of event.
 EventType Automation::getType(const string &n) const {
-  if (_events.find(n) != _events.end()) {
-    return _events.at(n).Component.type();
+  if (const auto* event = _events.find(n)) {
+    return event->Component.type();
   } else {
     throw std::invalid_argument("getType: event name doesn't exist");
   }
 }
 
 // Event deletion.
-void Automation::removeEvent(const string& n) noexcept {
-  if (_events.find(n) != _events.end()) {
-    for (const auto& state : _events.at(n).Inputs) {
-      _states.at(state.first).Outputs.erase(n);
+void Automation::removeEvent(const string& n) {
+  if (const auto* event = _events.find(n)) {
+    for (const auto& state : event->Inputs) {
+      _states.modify(state.first)->Outputs.erase(n);
+      _fingerprint -= fingerprintLink(state.first, n, true, state.second);
+      record(ChangeKind::setInputLink, state.first, n, 0);
     }
-    for (const auto& state : _events.at(n).Outputs) {
-      _states.at(state.first).Inputs.erase(n);
+    for (const auto& state : event->Outputs) {
+      _states.modify(state.first)->Inputs.erase(n);
+      _fingerprint -= fingerprintLink(state.first, n, false, state.second);
+      record(ChangeKind::setOutputLink, state.first, n, 0);
+    }
+    if (!_detached_events.erase(n)) {
+      _fingerprint -= fingerprintEvent(n, event->Component.type());
     }
     _events.erase(n);
+    record(ChangeKind::removeEvent, "", n, 0);
   }
 }
 
@@ -255,20 +327,29 @@ void Automation::setLinkFromStateToEvent(const string& s, const string& e, const
   if (!checkEvent(e)) {
     throw invalid_argument("setLinkFromStateToEvent: event name doesn't exist");
   }
+  auto* state = _states.modify(s);
+  auto* event = _events.modify(e);
+  const auto link = state->Outputs.find(e);
+  if (link != state->Outputs.end()) {
+    _fingerprint -= fingerprintLink(s, e, true, link->second);
+  }
   if (m) {
-    _states.at(s).Outputs[e] = m;
-    _events.at(e).Inputs[s] = m;
+    _fingerprint += fingerprintLink(s, e, true, m);
+    state->Outputs[e] = m;
+    event->Inputs[s] = m;
   } else {
-    _states.at(s).Outputs.erase(e);
-    _events.at(e).Inputs.erase(s);
+    state->Outputs.erase(e);
+    event->Inputs.erase(s);
   }
+  record(ChangeKind::setInputLink, s, e, m);
 }
 
 // Multiplicity of link from state to event.
 unsigned Automation::getLinksFromStateToEvent(const string& s, const string& e) const noexcept {
-  if (checkState(s) && checkEvent(e)) {
-    if (_events.at(e).Inputs.find(s) != _events.at(e).Inputs.end()) {
-      return _events.at(e).Inputs.at(s); // because it's positive
+  if (const auto* event = _events.find(e)) {
+    const auto link = event->Inputs.find(s);
+    if (link != event->Inputs.end()) {
+      return link->second; // because it's positive
     }
   }
   return 0;
@@ -282,20 +363,29 @@ void Automation::setLinkFromEventToState(const string& e, const string& s, const
   if (!checkState(s)) {
     throw invalid_argument("setLinkFromEventToState: state name doesn't exist");
   }
+  auto* event = _events.modify(e);
+  auto* state = _states.modify(s);
+  const auto link = state->Inputs.find(e);
+  if (link != state->Inputs.end()) {
+    _fingerprint -= fingerprintLink(s, e, false, link->second);
+  }
   if (m) {
-    _events.at(e).Outputs[s] = m;
-    _states.at(s).Inputs[e] = m;
+    _fingerprint += fingerprintLink(s, e, false, m);
+    event->Outputs[s] = m;
+    state->Inputs[e] = m;
   } else {
-    _events.at(e).Outputs.erase(s);
-    _states.at(s).Inputs.erase(e);
+    event->Outputs.erase(s);
+    state->Inputs.erase(e);
   }
+  record(ChangeKind::setOutputLink, s, e, m);
 }
 
 // Multiplicity of link from event to state.
 unsigned Automation::getLinksFromEventToState(const string& e, const string& s) const noexcept {
-  if (checkEvent(e) && checkState(s)) {
-    if (_states.at(s).Inputs.find(e) != _states.at(s).Inputs.end()) {
-      return _states.at(s).Inputs.at(e); // because it's positive
+  if (const auto* state = _states.find(s)) {
+    const auto link = state->Inputs.find(e);
+    if (link != state->Inputs.end()) {
+      return link->second; // because it's positive
     }
   }
   return 0;
@@ -315,7 +405,7 @@ void Automation::linkStatesByEvent(const string& f, const string& e, const strin
 bool Automation::checkMacro() const noexcept {
   for (const auto& e : _events) {
     if (isMacro(e.second.Component)) {
-      if (!getEventInputs(e.first).empty() || !getEventOutputs(e.first).empty()) {
+      if (!e.second.Inputs.empty() || !e.second.Outputs.empty()) {
         return false; // macro event links check
       }
       if (!checkMacroEvent(e.second.Component)) {
@@ -334,7 +424,7 @@ set<string> Automation::getReadyEvents() const noexcept {
     for (const auto& s : e.second.Inputs) {
       const auto& multiplicity = s.second;
       const auto& state_name = s.first;
-      if (multiplicity <= _states.at(state_name).Component.activity()) {
+      if (multiplicity <= _states.find(state_name)->Component.activity()) {
         is_ready = true;
       } else {
         is_ready = false; // not enough tokens for this link
@@ -342,7 +432,7 @@ set<string> Automation::getReadyEvents() const noexcept {
       }
     }
     if (is_ready) {
-      result.insert(e.first);
+      result.insert(result.end(), e.first);
     }
   }
   return result;
@@ -361,16 +451,87 @@ void Automation::fire(const string& e) {
   if (firing_event.empty()) {
     firing_event = *ready_events.begin();
   }
-  for (const auto& input : _events.at(firing_event).Inputs) {
-    const auto& activity = _states.at(input.first).Component.activity();
-    _states.at(input.first).Component.setActivity(activity - input.second);
+  const auto* event = _events.find(firing_event);
+  for (const auto& input : event->Inputs) {
+    auto& state = _states.modify(input.first)->Component;
+    replaceFingerprint(_fingerprint, _detached_states, input.first, fingerprintState(input.first, state.activity()),
+      fingerprintState(input.first, state.activity() - input.second));
+    state.setActivity(state.activity() - input.second);
+    record(ChangeKind::changeState, input.first, "", state.activity());
   }
-  for (const auto& output : _events.at(firing_event).Outputs) {
-    const auto& activity = _states.at(output.first).Component.activity();
-    _states.at(output.first).Component.setActivity(activity + output.second);
+  for (const auto& output : event->Outputs) {
+    auto& state = _states.modify(output.first)->Component;
+    replaceFingerprint(_fingerprint, _detached_states, output.first, fingerprintState(output.first, state.activity()),
+      fingerprintState(output.first, state.activity() + output.second));
+    state.setActivity(state.activity() + output.second);
+    record(ChangeKind::changeState, output.first, "", state.activity());
   }
 }
 
+// Snapshot of the automation.
+Automation Automation::snapshot() const {
+  return *this;
+}
+
+// Change counting and recording.
+void Automation::record(ChangeKind k, const string& s, const string& e, unsigned v) {
+  _journal.record(k, s, e, v);
+}
+
+// Copying of states and events changeable by references of the original.
+void Automation::ownDetached(const Automation& a) {
+  for (const auto& state : a._detached_states) {
+    _fingerprint += fingerprintState(state.first, _states.modify(state.first)->Component.activity());
+    _detached_states.erase(state.first);
+  }
+  for (const auto& event : a._detached_events) {
+    _fingerprint += fingerprintEvent(event.first, _events.modify(event.first)->Component.type());
+    _detached_events.erase(event.first);
+  }
+}
+
+// Structural fingerprint.
+Fingerprint Automation::fingerprint() const noexcept {
+  Fingerprint result = _fingerprint;
+  for (const auto& state : _detached_states) {
+    result += fingerprintState(state.first, _states.find(state.first)->Component.activity());
+  }
+  for (const auto& event : _detached_events) {
+    result += fingerprintEvent(event.first, _events.find(event.first)->Component.type());
+  }
+  return result;
+}
+
+// Start of change recording.
+void Automation::enableChangeLog() {
+  _journal.enable();
+}
+
+// Stop of change recording.
+void Automation::disableChangeLog() noexcept {
+  _journal.disable();
+}
+
+// Changes after snapshot.
+optional<vector<Change>> Automation::getChangesSince(const Automation& a) const {
+  return _journal.changesSince(a._journal);
+}
+
+// Changes after version.
+optional<vector<Change>> Automation::getChangesSince(uint64_t v) const {
+  return _journal.changesSince(v);
+}
+
+// Changed parts after version.
+optional<unsigned> Automation::getDirtySince(uint64_t v) const noexcept {
+  return _journal.dirtySince(v);
+}
+
+// Closing of change batch.
+uint64_t Automation::commitChanges() noexcept {
+  return _journal.commit();
+}
+
 // Correctness of macro event.
 bool Automation::checkMacroEvent(const Event& e) const noexcept {
   if (!isMacro(e)) {
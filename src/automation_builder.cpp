@@ -0,0 +1,221 @@
+/*! @file automation_builder.cpp
+@ref des::AutomationBuilder class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+#include "automation_builder.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Checks names and returns indexes of components in order of names.
+  template<class T>
+  vector<size_t> sortByNames(const vector<T>& c, const string& kind) {
+    for (const auto& x : c) {
+      if (!checkNameString(x.Name)) {
+        throw invalid_argument("build: " + kind + " name is invalid: " + x.Name);
+      }
+    }
+    vector<size_t> result(c.size());
+    iota(result.begin(), result.end(), 0);
+    auto byName = [&c](size_t l, size_t r) { return c[l].Name < c[r].Name; };
+    if (!is_sorted(result.begin(), result.end(), byName)) {
+      sort(result.begin(), result.end(), byName);
+    }
+    for (size_t k = 1; k < result.size(); k++) {
+      if (c[result[k - 1]].Name == c[result[k]].Name) {
+        throw invalid_argument("build: " + kind + " name already exists: " + c[result[k]].Name);
+      }
+    }
+    return result;
+  }
+
+  // Positions of components in order of names.
+  vector<size_t> positionsOf(const vector<size_t>& order) {
+    vector<size_t> result(order.size());
+    for (size_t k = 0; k < order.size(); k++) {
+      result[order[k]] = k;
+    }
+    return result;
+  }
+
+  // Hash table of names.
+  template<class T>
+  unordered_map<string_view, size_t> indexNames(const vector<T>& c) {
+    unordered_map<string_view, size_t> result;
+    result.reserve(c.size());
+    for (size_t k = 0; k < c.size(); k++) {
+      result.emplace(c[k].Name, k);
+    }
+    return result;
+  }
+
+} // namespace
+
+// Memory reservation.
+void AutomationBuilder::reserve(size_t s, size_t e, size_t l) {
+  _states.reserve(s);
+  _events.reserve(e);
+  _inputs.reserve(l / 2);
+  _outputs.reserve(l / 2);
+}
+
+// State addition.
+size_t AutomationBuilder::addState(string n, unsigned a) {
+  _states.push_back({ std::move(n), State(a) });
+  return _states.size() - 1;
+}
+
+// Event addition with creation.
+size_t AutomationBuilder::addEvent(string n, EventType t) {
+  _events.push_back({ std::move(n), Event(t) });
+  return _events.size() - 1;
+}
+
+// Event addition by moving.
+size_t AutomationBuilder::addEvent(string n, Event e) {
+  _events.push_back({ std::move(n), std::move(e) });
+  return _events.size() - 1;
+}
+
+// Link from state to event by indexes.
+void AutomationBuilder::addLinkFromStateToEvent(size_t s, size_t e, unsigned m) {
+  _inputs.push_back({ s, e, m });
+}
+
+// Link from event to state by indexes.
+void AutomationBuilder::addLinkFromEventToState(size_t e, size_t s, unsigned m) {
+  _outputs.push_back({ s, e, m });
+}
+
+// Link from state to event by names.
+void AutomationBuilder::addLinkFromStateToEvent(string s, string e, unsigned m) {
+  _named_links.push_back({ std::move(s), std::move(e), m, true });
+}
+
+// Link from event to state by names.
+void AutomationBuilder::addLinkFromEventToState(string e, string s, unsigned m) {
+  _named_links.push_back({ std::move(s), std::move(e), m, false });
+}
+
+// Creation of automation.
+Automation AutomationBuilder::build(pmr::memory_resource* r) {
+  const vector<size_t> state_order = sortByNames(_states, "state");
+  const vector<size_t> event_order = sortByNames(_events, "event");
+
+  // masked event lists refer to added events
+  auto eventExists = [&](const string& n) {
+    const auto it = lower_bound(event_order.begin(), event_order.end(), n,
+      [&](size_t k, const string& v) { return _events[k].Name < v; });
+    return it != event_order.end() && _events[*it].Name == n;
+  };
+  for (const auto& e : _events) {
+    if (isMacro(e.Value)) {
+      for (const auto& n : e.Value.getMaskedEvents()) {
+        if (!eventExists(n)) {
+          throw runtime_error("build: masked events list of macro event is invalid: " + e.Name);
+        }
+      }
+    }
+  }
+
+  // links by names are resolved into links by indexes
+  if (!_named_links.empty()) {
+    const auto state_indexes = indexNames(_states);
+    const auto event_indexes = indexNames(_events);
+    for (const auto& l : _named_links) {
+      const auto s = state_indexes.find(l.State);
+      if (s == state_indexes.end()) {
+        throw invalid_argument("build: link refers to nonexistent state " + l.State);
+      }
+      const auto e = event_indexes.find(l.Event);
+      if (e == event_indexes.end()) {
+        throw invalid_argument("build: link refers to nonexistent event " + l.Event);
+      }
+      (l.Input ? _inputs : _outputs).push_back({ s->second, e->second, l.Multiplicity });
+    }
+    _named_links.clear();
+  }
+
+  // links get positions of sorted names, parallel links are merged
+  const vector<size_t> state_positions = positionsOf(state_order), event_positions = positionsOf(event_order);
+  auto merge = [&](vector<Link>& l) {
+    for (auto& x : l) {
+      if (x.State >= _states.size()) {
+        throw invalid_argument("build: link refers to nonexistent state");
+      }
+      if (x.Event >= _events.size()) {
+        throw invalid_argument("build: link refers to nonexistent event");
+      }
+      x.State = state_positions[x.State];
+      x.Event = event_positions[x.Event];
+    }
+    sort(l.begin(), l.end(), [](const Link& x, const Link& y) {
+      return x.Event != y.Event ? x.Event < y.Event : x.State < y.State;
+    });
+    size_t merged = 0;
+    for (size_t k = 0; k < l.size(); k++) {
+      if (merged && l[merged - 1].Event == l[k].Event && l[merged - 1].State == l[k].State) {
+        l[merged - 1].Multiplicity += l[k].Multiplicity;
+      }
+      else if (l[k].Multiplicity) {
+        l[merged++] = l[k];
+      }
+      if (merged && l[merged - 1].Multiplicity > numeric_limits<unsigned>::max()) {
+        throw invalid_argument("build: multiplicity of parallel links exceeds UINT_MAX");
+      }
+    }
+    l.resize(merged);
+  };
+  merge(_inputs);
+  merge(_outputs);
+
+  // all names are appended in sorted order
+  Automation result(r);
+  vector<pair<const string*, Automation::ComponentWithLinks<State>*>> states;
+  states.reserve(_states.size());
+  for (const auto& k : state_order) {
+    auto& c = _states[k];
+    result._fingerprint += fingerprintState(c.Name, c.Value.activity());
+    states.emplace_back(&c.Name, &result._states.append(c.Name,
+      Automation::ComponentWithLinks<State>(std::move(c.Value))));
+  }
+  vector<pair<const string*, Automation::ComponentWithLinks<Event>*>> events;
+  events.reserve(_events.size());
+  for (const auto& k : event_order) {
+    auto& c = _events[k];
+    result._fingerprint += fingerprintEvent(c.Name, c.Value.type());
+    events.emplace_back(&c.Name, &result._events.append(c.Name,
+      Automation::ComponentWithLinks<Event>(std::move(c.Value))));
+  }
+  auto link = [&](vector<Link>& l, bool input) {
+    for (const auto& x : l) { // ordered by events
+      result._fingerprint += fingerprintLink(*states[x.State].first, *events[x.Event].first, input,
+        static_cast<unsigned>(x.Multiplicity));
+      auto& links = input ? events[x.Event].second->Inputs : events[x.Event].second->Outputs;
+      links.emplace_hint(links.end(), *states[x.State].first, static_cast<unsigned>(x.Multiplicity));
+    }
+    sort(l.begin(), l.end(), [](const Link& x, const Link& y) {
+      return x.State != y.State ? x.State < y.State : x.Event < y.Event;
+    });
+    for (const auto& x : l) {
+      auto& links = input ? states[x.State].second->Outputs : states[x.State].second->Inputs;
+      links.emplace_hint(links.end(), *events[x.Event].first, static_cast<unsigned>(x.Multiplicity));
+    }
+  };
+  link(_inputs, true);
+  link(_outputs, false);
+
+  *this = AutomationBuilder();
+  return result;
+}
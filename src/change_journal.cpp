@@ -0,0 +1,210 @@
+/*! @file change_journal.cpp
+@ref des::ChangeJournal class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <atomic>
+
+#include "change_journal.hpp"
+#include "components.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  const size_t chunk_records = 4096; // names of a chunk take less than 2 MB, so offsets fit 32 bits
+
+  static_assert(max_name_length <= 256, "lengths of names must fit a byte");
+
+  const uint8_t batch_start = 1; // flag of the first change after a commit
+
+} // namespace
+
+// Dirty flags of change kind.
+unsigned des::dirtyFlags(ChangeKind k) noexcept {
+  switch (k) {
+    case ChangeKind::addState:
+    case ChangeKind::removeState:
+      return dirtyStates | dirtyMarking;
+    case ChangeKind::changeState:
+      return dirtyMarking;
+    case ChangeKind::addEvent:
+    case ChangeKind::removeEvent:
+      return dirtyEvents;
+    case ChangeKind::changeEvent:
+      return dirtyTypes;
+    case ChangeKind::setInputLink:
+    case ChangeKind::setOutputLink:
+      return dirtyLinks;
+  }
+  return 0;
+}
+
+// Constructor of des::ChangeJournal object.
+ChangeJournal::ChangeJournal(pmr::memory_resource* r) noexcept : _resource(r) {
+}
+
+// Constructor of des::ChangeJournal object sharing chunks with memory resource.
+ChangeJournal::ChangeJournal(const ChangeJournal& j, pmr::memory_resource* r) noexcept : _resource(r),
+  _version(j._version), _committed(j._committed), _last(j._last) {
+}
+
+// Constructor of chunk.
+ChangeJournal::Chunk::Chunk(uint64_t f, shared_ptr<Chunk> p, pmr::memory_resource* r) :
+  Records(r), Names(r), First(f), Previous(std::move(p)) {
+  Records.reserve(16);
+}
+
+// Destructor of chunk.
+ChangeJournal::Chunk::~Chunk() {
+  auto previous = std::move(Previous);
+  while (previous && previous.use_count() == 1) {
+    previous = std::move(previous->Previous);
+  }
+}
+
+// The first known version.
+optional<uint64_t> ChangeJournal::firstVersion() const noexcept {
+  const Chunk* c = _last.get();
+  while (c && c->Previous) {
+    c = c->Previous.get();
+  }
+  return c ? optional<uint64_t>(c->First) : nullopt;
+}
+
+// Start of change recording.
+void ChangeJournal::enable() {
+  if (!_last) { // the empty chunk marks the version, from which changes are known
+    _last = allocate_shared<Chunk>(pmr::polymorphic_allocator<Chunk>(_resource), _version, nullptr, _resource);
+  }
+}
+
+// Stop of change recording.
+void ChangeJournal::disable() noexcept {
+  _last.reset();
+}
+
+// Change counting and recording.
+void ChangeJournal::record(ChangeKind k, const string& s, const string& e, unsigned v) {
+  const bool first = _committed == _version;
+  _version++;
+  if (!_last) {
+    return;
+  }
+  bool shared = _last.use_count() > 1;
+  if (!shared) {
+    atomic_thread_fence(memory_order_acquire); // releases of other owners happen before the change of the chunk
+  }
+  if (shared || _last->Records.size() == chunk_records) {
+    _last = allocate_shared<Chunk>(pmr::polymorphic_allocator<Chunk>(_resource), _version - 1, std::move(_last),
+      _resource);
+  }
+  Record r;
+  r.Offset = static_cast<uint32_t>(_last->Names.size());
+  r.Value = v;
+  r.Kind = static_cast<uint8_t>(k);
+  r.StateLength = static_cast<uint8_t>(s.size());
+  r.EventLength = static_cast<uint8_t>(e.size());
+  r.Flags = first ? batch_start : 0;
+  _last->Records.push_back(r);
+  _last->Names.append(s).append(e);
+  _last->Dirty |= dirtyFlags(k);
+}
+
+// Batch closing.
+uint64_t ChangeJournal::commit() noexcept {
+  return _committed = _version;
+}
+
+// Chunk containing changes after version.
+const ChangeJournal::Chunk* ChangeJournal::locate(uint64_t v) const noexcept {
+  if (v > _version) {
+    return nullptr;
+  }
+  const Chunk* c = _last.get();
+  while (c && c->First > v) {
+    c = c->Previous.get();
+  }
+  return c;
+}
+
+// Collection of changes.
+void ChangeJournal::collect(uint64_t v, vector<Change>& c) const {
+  vector<const Chunk*> chunks;
+  for (const Chunk* k = _last.get(); k && k->First + k->Records.size() > v; k = k->Previous.get()) {
+    chunks.push_back(k);
+  }
+  c.reserve(c.size() + (_version - v));
+  for (auto k = chunks.rbegin(); k != chunks.rend(); k++) {
+    const Chunk& chunk = **k;
+    for (size_t i = v > chunk.First ? v - chunk.First : 0; i < chunk.Records.size(); i++) {
+      const Record& r = chunk.Records[i];
+      if ((r.Flags & batch_start) && !c.empty()) {
+        c.back().Commit = true;
+      }
+      const char* names = chunk.Names.data() + r.Offset;
+      c.push_back({ static_cast<ChangeKind>(r.Kind), string(names, r.StateLength),
+        string(names + r.StateLength, r.EventLength), r.Value, chunk.First + i + 1, false });
+    }
+  }
+  if (!c.empty() && c.back().Version == _committed) {
+    c.back().Commit = true;
+  }
+}
+
+// Changes after version.
+optional<vector<Change>> ChangeJournal::changesSince(uint64_t v) const {
+  if (!locate(v)) {
+    return nullopt;
+  }
+  vector<Change> result;
+  collect(v, result);
+  return result;
+}
+
+// Changes after other journal.
+optional<vector<Change>> ChangeJournal::changesSince(const ChangeJournal& j) const {
+  if (!j._last || j._version > _version) {
+    return nullopt;
+  }
+  const Chunk* c = _last.get();
+  while (c && c != j._last.get() && c->First >= j._version) {
+    c = c->Previous.get();
+  }
+  if (c != j._last.get()) {
+    return nullopt;
+  }
+  vector<Change> result;
+  collect(j._version, result);
+  return result;
+}
+
+// Changed parts after version.
+optional<unsigned> ChangeJournal::dirtySince(uint64_t v) const noexcept {
+  const Chunk* found = locate(v);
+  if (!found) {
+    return nullopt;
+  }
+  unsigned result = 0;
+  for (const Chunk* c = _last.get(); c != found; c = c->Previous.get()) {
+    result |= c->Dirty;
+  }
+  if (found->First == v) {
+    return result | found->Dirty;
+  }
+  for (size_t i = v - found->First; i < found->Records.size(); i++) {
+    result |= dirtyFlags(static_cast<ChangeKind>(found->Records[i].Kind));
+  }
+  return result;
+}
+
+// Memory of records and names.
+size_t ChangeJournal::memory() const noexcept {
+  size_t result = 0;
+  for (const Chunk* c = _last.get(); c; c = c->Previous.get()) {
+    result += c->Records.capacity() * sizeof(Record) + c->Names.capacity();
+  }
+  return result;
+}
@@ -0,0 +1,142 @@
+/*! @file compiled_net.cpp
+@ref des::CompiledNet class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "compiled_net.hpp"
+#include "net_binary.hpp"
+
+
+using namespace std;
+using namespace des;
+
+// Constructor of des::CompiledNet object.
+CompiledNet::CompiledNet(const Automation& a) : _state_names(), _event_names(), _event_types(), _initial(),
+  _input_offsets(1, 0), _inputs(), _output_offsets(1, 0), _outputs() {
+  map<string, unsigned> state_indexes;
+  _state_names.reserve(a._states.size());
+  _initial.reserve(a._states.size());
+  for (const auto& s : a._states) {
+    state_indexes.emplace_hint(state_indexes.end(), s.first, static_cast<unsigned>(_state_names.size()));
+    _state_names.push_back(s.first);
+    _initial.push_back(s.second.Component.activity());
+  }
+  _event_names.reserve(a._events.size());
+  _event_types.reserve(a._events.size());
+  for (const auto& e : a._events) {
+    _event_names.push_back(e.first);
+    _event_types.push_back(e.second.Component.type());
+    for (const auto& i : e.second.Inputs) {
+      _inputs.push_back({ state_indexes.at(i.first), i.second });
+    }
+    _input_offsets.push_back(_inputs.size());
+    for (const auto& o : e.second.Outputs) {
+      _outputs.push_back({ state_indexes.at(o.first), o.second });
+    }
+    _output_offsets.push_back(_outputs.size());
+  }
+  indexConsumers();
+}
+
+// Constructor of des::CompiledNet object from binary net.
+CompiledNet::CompiledNet(const MappedNet& m) : _state_names(), _event_names(), _event_types(), _initial(),
+  _input_offsets(1, 0), _inputs(m.getInputs().begin(), m.getInputs().end()), _output_offsets(1, 0),
+  _outputs(m.getOutputs().begin(), m.getOutputs().end()) {
+  _state_names.reserve(m.getStateQuantity());
+  _initial.reserve(m.getStateQuantity());
+  for (size_t i = 0; i < m.getStateQuantity(); i++) {
+    _state_names.emplace_back(m.getStateName(i));
+    _initial.push_back(m.getActivity(i));
+  }
+  _event_names.reserve(m.getEventQuantity());
+  _event_types.reserve(m.getEventQuantity());
+  _input_offsets.reserve(m.getEventQuantity() + 1);
+  _output_offsets.reserve(m.getEventQuantity() + 1);
+  for (size_t t = 0; t < m.getEventQuantity(); t++) {
+    _event_names.emplace_back(m.getEventName(t));
+    _event_types.push_back(m.getType(t));
+    _input_offsets.push_back(_input_offsets.back() + m.getEventInputs(t).size());
+    _output_offsets.push_back(_output_offsets.back() + m.getEventOutputs(t).size());
+  }
+  indexConsumers();
+}
+
+// State index search, names are sorted as keys of des::Automation.
+size_t CompiledNet::getStateIndex(const string& n) const {
+  const auto i = lower_bound(_state_names.begin(), _state_names.end(), n);
+  if (i == _state_names.end() || *i != n) {
+    throw out_of_range("getStateIndex: the net hasn't state " + n);
+  }
+  return static_cast<size_t>(i - _state_names.begin());
+}
+
+// Event index search, names are sorted as keys of des::Automation.
+size_t CompiledNet::getEventIndex(const string& n) const {
+  const auto i = lower_bound(_event_names.begin(), _event_names.end(), n);
+  if (i == _event_names.end() || *i != n) {
+    throw out_of_range("getEventIndex: the net hasn't event " + n);
+  }
+  return static_cast<size_t>(i - _event_names.begin());
+}
+
+// Quantity of unsatisfied input links.
+unsigned CompiledNet::getMissingInputs(const Marking& m, size_t t) const noexcept {
+  const auto& inputs = getEventInputs(t);
+  unsigned result = inputs.empty() ? 1 : 0; // event without input links never fires
+  for (const auto& i : inputs) {
+    if (m[i.Index] < i.Multiplicity) {
+      result++;
+    }
+  }
+  return result;
+}
+
+// Ready event check.
+bool CompiledNet::isReady(const Marking& m, size_t t) const noexcept {
+  const auto& inputs = getEventInputs(t);
+  if (inputs.empty()) {
+    return false; // event without input links never fires
+  }
+  for (const auto& i : inputs) {
+    if (m[i.Index] < i.Multiplicity) {
+      return false; // not enough tokens for this link (omega is the greatest value)
+    }
+  }
+  return true;
+}
+
+// Firing of the ready event.
+void CompiledNet::fire(const Marking& m, size_t t, Marking& r) const {
+  r = m;
+  for (const auto& i : getEventInputs(t)) {
+    if (r[i.Index] != omega) {
+      r[i.Index] -= i.Multiplicity;
+    }
+  }
+  for (const auto& o : getEventOutputs(t)) {
+    if (r[o.Index] != omega) {
+      r[o.Index] = omega - r[o.Index] > o.Multiplicity ? r[o.Index] + o.Multiplicity : omega - 1;
+    }
+  }
+}
+
+// Index of input links by states, it's built by counting sort of links.
+void CompiledNet::indexConsumers() {
+  _consumer_offsets.assign(getStateQuantity() + 1, 0);
+  for (const auto& i : _inputs) {
+    _consumer_offsets[i.Index + 1]++;
+  }
+  for (size_t s = 0; s < getStateQuantity(); s++) {
+    _consumer_offsets[s + 1] += _consumer_offsets[s];
+  }
+  _consumers.resize(_inputs.size());
+  vector<size_t> positions(_consumer_offsets.begin(), _consumer_offsets.end() - 1);
+  for (size_t t = 0; t < getEventQuantity(); t++) {
+    for (const auto& i : getEventInputs(t)) {
+      _consumers[positions[i.Index]++] = { static_cast<unsigned>(t), i.Multiplicity };
+    }
+  }
+}
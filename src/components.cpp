@@ -3,6 +3,9 @@ DES model components classes source file.
 @authors A. Kozov
 @date 2021/12/15 */
 
+#include <array>
+#include <cstdint>
+
 #include "components.hpp"
 #include "state.hpp"
 #include "event.hpp"
@@ -26,10 +29,37 @@ bool des::operator==(const BehaviorAttribute& l, const BehaviorAttribute& r) noe
   return l.Type == r.Type && l.Restrictions == r.Restrictions;
 }
 
+namespace {
+
+  // Flags of characters in names.
+  const uint8_t name_first = 1; // Latin letter, allowed as the first character
+  const uint8_t name_next = 2;  // Latin letter, digit, underscore or slash, allowed after the first character
+
+  // Table of character flags, it's the classification of "C" locale used by std::regex before.
+  constexpr array<uint8_t, 256> name_table = []() {
+    array<uint8_t, 256> result = {};
+    for (int c = 0; c < 256; c++) {
+      const bool letter = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+      const bool other = (c >= '0' && c <= '9') || c == '_' || c == '/';
+      result[c] = static_cast<uint8_t>((letter ? name_first | name_next : 0) | (other ? name_next : 0));
+    }
+    return result;
+  }();
+
+} // namespace
+
 // Correctness check of name string.
 bool des::checkNameString(const string& s) {
-  const static regex r("[[:alpha:]][[:alpha:][:digit:]_/]*");
-  return s.length() < max_name_length && regex_match(s, r);
+  const size_t n = s.length();
+  if (n == 0 || n >= max_name_length || !(name_table[static_cast<unsigned char>(s[0])] & name_first)) {
+    return false;
+  }
+  // flags are accumulated without branches, names are short and almost always valid
+  uint8_t flags = name_next;
+  for (size_t k = 1; k < n; k++) {
+    flags &= name_table[static_cast<unsigned char>(s[k])];
+  }
+  return flags != 0;
 }
 
 
@@ -53,7 +83,7 @@ bool State::operator==(const State& s) const noexcept {
 // Event class.
 
 // Constructor of the des::Event object.
-Event::Event(const EventType& t) : _type(t), _properties(), _attributes(), _masked_events(), _mapping_rules() {
+Event::Event(const EventType& t) : _type(t), _metadata() {
 }
 
 // Copy of masked event list from macro event.
@@ -61,7 +91,8 @@ std::list<string> Event::getMaskedEvents() const {
   if (_type != EventType::macro) {
     throw std::logic_error("getMaskedEvents: event isn't macro event");
   }
-  return _masked_events;
+  const auto* m = _metadata.find();
+  return m ? m->MaskedEvents : std::list<string>();
 }
 
 // Masked event list setting.
@@ -69,7 +100,7 @@ void Event::setMaskedEvents(const std::list<string>& l) {
   if (_type != EventType::macro) {
     throw std::logic_error("setMaskedEvents: event isn't macro event");
   }
-  _masked_events = l;
+  _metadata.get().MaskedEvents = l;
 }
 
 // Masked event addition.
@@ -77,7 +108,7 @@ void Event::addMaskedEvent(const string& e) {
   if (_type != EventType::macro) {
     throw std::logic_error("addMaskedEvent: event isn't macro event");
   }
-  _masked_events.emplace(_masked_events.end(), e);
+  _metadata.get().MaskedEvents.push_back(e);
 }
 
 // Copy of mapping rule list from macro event.
@@ -85,7 +116,8 @@ std::list<BehaviorAttributeRestriction> Event::getMappingRules() const {
   if (_type != EventType::macro) {
     throw std::logic_error("getMappingRules: event isn't macro event");
   }
-  return _mapping_rules;
+  const auto* m = _metadata.find();
+  return m ? m->MappingRules : std::list<BehaviorAttributeRestriction>();
 }
 
 // Mapping rule list setting.
@@ -93,7 +125,7 @@ void Event::setMappingRules(const std::list<BehaviorAttributeRestriction>& l) {
   if (_type != EventType::macro) {
     throw std::logic_error("setMappingRules: event isn't macro event");
   }
-  _mapping_rules = l;
+  _metadata.get().MappingRules = l;
 }
 
 // Mapping rule addition.
@@ -101,13 +133,18 @@ void Event::addMappingRule(const BehaviorAttributeRestriction& r) {
   if (_type != EventType::macro) {
     throw std::logic_error("addMappingRule: event isn't macro event");
   }
-  _mapping_rules.emplace(_mapping_rules.end(), r);
+  _metadata.get().MappingRules.push_back(r);
 }
 
 // Equivalence check of two des::Event objects.
 bool Event::operator==(const Event& e) const noexcept {
-  const bool& s = _type == e._type && _properties == e._properties && _attributes == e._attributes;
-  return s && _masked_events == e._masked_events && _mapping_rules == e._mapping_rules;
+  return _type == e._type && _metadata == e._metadata;
+}
+
+// Equivalence check of two des::Event::Metadata objects.
+bool Event::Metadata::operator==(const Metadata& m) const noexcept {
+  const bool& s = Properties == m.Properties && Attributes == m.Attributes;
+  return s && MaskedEvents == m.MaskedEvents && MappingRules == m.MappingRules;
 }
 
 // Controllable event check.
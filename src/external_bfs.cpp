@@ -0,0 +1,328 @@
+/*! @file external_bfs.cpp
+@ref des::ExternalExplorer class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stdexcept>
+
+#include "external_bfs.hpp"
+
+
+using namespace std;
+using namespace des;
+namespace fs = std::filesystem;
+
+namespace {
+
+  // Min quantity of records in one read buffer.
+  const size_t min_buffer_records = 64;
+
+  // Quantity of expanded records between clock checks for progress reporting.
+  const size_t progress_check_period = 1024;
+
+  // Comparison of two records, the same order is used for sorting and merging.
+  inline int compareRecords(const unsigned* l, const unsigned* r, size_t w) noexcept {
+    return memcmp(l, r, w * sizeof(unsigned));
+  }
+
+  // Working directory, removed with all run files.
+  class WorkDirectory {
+  public:
+    explicit WorkDirectory(const string& d) {
+      const fs::path base = d.empty() ? fs::temp_directory_path() : fs::path(d);
+      random_device r;
+      for (unsigned i = 0; i < 16 && _path.empty(); i++) {
+        const fs::path p = base / ("des-bfs-" + to_string(r()));
+        if (fs::create_directories(p)) {
+          _path = p;
+        }
+      }
+      if (_path.empty()) {
+        throw runtime_error("ExternalExplorer: working directory can't be created");
+      }
+    }
+    ~WorkDirectory() {
+      error_code e;
+      fs::remove_all(_path, e);
+    }
+    fs::path file(const string& n) {
+      return _path / (n + "-" + to_string(_counter++));
+    }
+  private:
+    fs::path _path;
+    size_t _counter = 0;
+  };
+
+  // Sequential writer of records.
+  class RecordWriter {
+  public:
+    RecordWriter(const fs::path& p, size_t w) : _path(p), _file(p, ios::binary | ios::trunc), _width(w) {
+      if (!_file) {
+        throw runtime_error("ExternalExplorer: run file can't be created");
+      }
+    }
+    void write(const unsigned* r) {
+      _file.write(reinterpret_cast<const char*>(r), static_cast<streamsize>(_width * sizeof(unsigned)));
+      _count++;
+    }
+    size_t close() {
+      _file.close();
+      if (!_file) {
+        throw runtime_error("ExternalExplorer: run file can't be written");
+      }
+      return _count;
+    }
+    const fs::path& path() const noexcept {
+      return _path;
+    }
+  private:
+    fs::path _path;
+    ofstream _file;
+    size_t _width;
+    size_t _count = 0;
+  };
+
+  // Buffered sequential reader of records.
+  class RecordReader {
+  public:
+    RecordReader(const fs::path& p, size_t w, size_t b) : _file(p, ios::binary), _width(w), _buffer() {
+      if (!_file) {
+        throw runtime_error("ExternalExplorer: run file can't be opened");
+      }
+      const size_t records = static_cast<size_t>(fs::file_size(p)) / (w * sizeof(unsigned));
+      _buffer.resize(w * max<size_t>(min(b, records), 1)); // buffer isn't larger than the file
+      fill();
+    }
+    const unsigned* current() const noexcept {
+      return _position < _count ? _buffer.data() + _position * _width : nullptr;
+    }
+    void next() {
+      if (++_position == _count) {
+        fill();
+      }
+    }
+  private:
+    void fill() {
+      _file.read(reinterpret_cast<char*>(_buffer.data()), static_cast<streamsize>(_buffer.size() * sizeof(unsigned)));
+      _count = static_cast<size_t>(_file.gcount()) / (_width * sizeof(unsigned));
+      _position = 0;
+      if (_file.bad()) {
+        throw runtime_error("ExternalExplorer: run file can't be read");
+      }
+    }
+    ifstream _file;
+    size_t _width;
+    vector<unsigned> _buffer;
+    size_t _count = 0;
+    size_t _position = 0;
+  };
+
+} // namespace
+
+
+// Constructor of des::ExternalExplorer object.
+ExternalExplorer::ExternalExplorer(const CompiledNet& n, const ExternalExplorerOptions& o) : _net(n), _options(o) {
+}
+
+// Disk-backed breadth-first exploration.
+ExternalExplorerResult ExternalExplorer::run() {
+  ExternalExplorerResult result;
+  const size_t width = max<size_t>(_net.getStateQuantity(), 1); // zero width records can't be ordered
+  const size_t record_bytes = width * sizeof(unsigned);
+  const size_t buffer_records = max(_options.MemoryBudget / 2 / record_bytes, min_buffer_records);
+  result.Bounds.assign(_net.getStateQuantity(), 0);
+  WorkDirectory directory(_options.Directory);
+
+  Marking initial = _net.getInitialMarking();
+  initial.resize(width, 0);
+  auto visited = directory.file("visited");
+  auto layer = directory.file("layer");
+  for (const auto& p : { visited, layer }) {
+    RecordWriter w(p, width);
+    w.write(initial.data());
+    w.close();
+  }
+  result.States = 1;
+  result.BytesWritten = 2 * record_bytes;
+
+  bool complete = true;
+  vector<unsigned> buffer; // successors not yet written into runs
+  buffer.reserve(buffer_records * width);
+  vector<fs::path> runs;
+  Marking current(width), next(width);
+
+  const auto started = chrono::steady_clock::now();
+  auto next_report = started + _options.ProgressInterval;
+  size_t layer_size = 1, expanded = 0;
+  // reports progress, if the interval is over
+  auto report = [&](bool last) {
+    const auto now = chrono::steady_clock::now();
+    if (!last && now < next_report) {
+      return;
+    }
+    next_report = now + _options.ProgressInterval;
+    AnalysisProgress p;
+    p.States = result.States;
+    p.Frontier = layer_size - expanded;
+    p.Memory = (buffer.capacity() + current.size() + next.size()) * sizeof(unsigned);
+    p.Depth = result.Layers;
+    p.Elapsed = chrono::duration_cast<chrono::milliseconds>(now - started);
+    const double seconds = chrono::duration<double>(now - started).count();
+    if (seconds > 0) {
+      p.StatesPerSecond = static_cast<double>(result.States) / seconds;
+    }
+    _options.Progress(p);
+  };
+
+  // sorts the buffer and writes it into a new run file without duplicates
+  auto flush = [&]() {
+    const size_t count = buffer.size() / width;
+    vector<size_t> order(count);
+    for (size_t i = 0; i < count; i++) {
+      order[i] = i;
+    }
+    sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+      return compareRecords(buffer.data() + l * width, buffer.data() + r * width, width) < 0;
+    });
+    RecordWriter w(directory.file("run"), width);
+    const unsigned* last = nullptr;
+    for (const auto& i : order) {
+      const unsigned* r = buffer.data() + i * width;
+      if (!last || compareRecords(last, r, width) != 0) {
+        w.write(r);
+        last = r;
+      }
+    }
+    result.BytesWritten += w.close() * record_bytes;
+    result.Runs++;
+    runs.push_back(w.path());
+    buffer.clear();
+  };
+
+  while (complete) {
+    // expansion of the layer
+    {
+      RecordReader reader(layer, width, buffer_records / 4 + min_buffer_records);
+      for (const unsigned* r = reader.current(); r; reader.next(), r = reader.current()) {
+        copy(r, r + width, current.begin());
+        bool has_ready = false;
+        for (size_t t = 0; t < _net.getEventQuantity(); t++) {
+          if (!_net.isReady(current, t)) {
+            continue;
+          }
+          has_ready = true;
+          _net.fire(current, t, next);
+          result.Transitions++;
+          for (size_t s = 0; s < _net.getStateQuantity(); s++) {
+            if (next[s] > _options.TokenBound || next[s] == omega - 1) {
+              complete = false; // token quantity is out of bound, the net is probably unbounded
+            }
+          }
+          buffer.insert(buffer.end(), next.begin(), next.end());
+          if (buffer.size() >= buffer_records * width) {
+            flush();
+          }
+        }
+        if (!has_ready) {
+          result.Deadlocks++;
+        }
+        for (size_t s = 0; s < _net.getStateQuantity(); s++) {
+          result.Bounds[s] = max(result.Bounds[s], r[s]);
+        }
+        if (_options.Progress && ++expanded % progress_check_period == 0) {
+          report(false);
+        }
+      }
+    }
+    fs::remove(layer);
+    if (!buffer.empty()) {
+      flush();
+    }
+    if (runs.empty() || !complete) {
+      break; // no successors or exploration is stopped
+    }
+
+    // merge of runs with subtraction of visited markings
+    const size_t merge_records = max(buffer_records / (runs.size() + 1), min_buffer_records);
+    vector<unique_ptr<RecordReader>> readers;
+    for (const auto& p : runs) {
+      readers.push_back(make_unique<RecordReader>(p, width, merge_records));
+    }
+    auto greater = [&](size_t l, size_t r) {
+      return compareRecords(readers[l]->current(), readers[r]->current(), width) > 0;
+    };
+    priority_queue<size_t, vector<size_t>, decltype(greater)> heap(greater);
+    for (size_t i = 0; i < readers.size(); i++) {
+      if (readers[i]->current()) {
+        heap.push(i);
+      }
+    }
+    RecordReader old_visited(visited, width, merge_records);
+    RecordWriter new_visited(directory.file("visited"), width);
+    RecordWriter new_layer(directory.file("layer"), width);
+    Marking last(width);
+    bool has_last = false;
+    while (!heap.empty()) {
+      const size_t i = heap.top();
+      heap.pop();
+      const unsigned* c = readers[i]->current();
+      if (!has_last || compareRecords(last.data(), c, width) != 0) {
+        copy(c, c + width, last.begin());
+        has_last = true;
+        int order = 1;
+        for (const unsigned* v = old_visited.current(); v; old_visited.next(), v = old_visited.current()) {
+          order = compareRecords(v, c, width);
+          if (order >= 0) {
+            break;
+          }
+          new_visited.write(v);
+        }
+        if (order != 0) {
+          new_visited.write(c);
+          new_layer.write(c);
+        }
+      }
+      readers[i]->next();
+      if (readers[i]->current()) {
+        heap.push(i);
+      }
+    }
+    for (const unsigned* v = old_visited.current(); v; old_visited.next(), v = old_visited.current()) {
+      new_visited.write(v);
+    }
+    readers.clear();
+    for (const auto& p : runs) {
+      fs::remove(p);
+    }
+    runs.clear();
+    const size_t visited_size = new_visited.close();
+    const size_t new_states = new_layer.close();
+    result.BytesWritten += (visited_size + new_states) * record_bytes;
+    fs::remove(visited);
+    visited = new_visited.path();
+    layer = new_layer.path();
+    result.States += new_states;
+    layer_size = new_states;
+    expanded = 0;
+    if (new_states == 0) {
+      break; // the successors are visited markings
+    }
+    result.Layers++;
+    if (_options.MaxStates && result.States >= _options.MaxStates) {
+      complete = false; // the last layer isn't expanded
+    }
+  }
+  result.Complete = complete;
+  if (_options.Progress) {
+    report(true);
+  }
+  return result;
+}
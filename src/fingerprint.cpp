@@ -0,0 +1,99 @@
+/*! @file fingerprint.cpp
+Structural fingerprint of Petri nets source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <cstdio>
+
+#include "fingerprint.hpp"
+#include "splitmix.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Tags of components, they separate fingerprints of states, events and links with equal names.
+  const uint8_t state_tag = 1;
+  const uint8_t event_tag = 2;
+  const uint8_t input_tag = 3;
+  const uint8_t output_tag = 4;
+
+  // Finalizer of MurmurHash3, its constants are unrelated to ones of mix64.
+  inline uint64_t fmix64(uint64_t x) noexcept {
+    x = (x ^ (x >> 33)) * 0xff51afd7ed558ccdULL;
+    x = (x ^ (x >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+    return x ^ (x >> 33);
+  }
+
+  // Two unrelated 64-bit hashes: FNV-1a finalized by mix64 and rotate-multiply hash finalized by fmix64.
+  class Hasher {
+  public:
+    inline void add(uint8_t b) noexcept {
+      _high = (_high ^ b) * fnv_prime;
+      _low = ((_low << 5 | _low >> 59) ^ b) * rotate_prime;
+    }
+
+    inline void add(const string& s) noexcept {
+      for (const char c : s) {
+        add(static_cast<uint8_t>(c));
+      }
+      add(uint8_t(0)); // names don't contain zero characters
+    }
+
+    inline void add(unsigned v) noexcept {
+      for (int k = 0; k < 4; k++) {
+        add(static_cast<uint8_t>(v >> (8 * k)));
+      }
+    }
+
+    [[nodiscard]] inline Fingerprint result() const noexcept {
+      return { mix64(_high), fmix64(_low) };
+    }
+
+  private:
+    static const uint64_t fnv_prime = 0x100000001b3ULL;
+    static const uint64_t rotate_prime = 0x87c37b91114253d5ULL;
+
+    uint64_t _high = 0xcbf29ce484222325ULL;
+    uint64_t _low = golden_gamma;
+  };
+
+} // namespace
+
+// Hexadecimal representation.
+string Fingerprint::toString() const {
+  char result[33];
+  snprintf(result, sizeof(result), "%016llx%016llx", static_cast<unsigned long long>(High),
+    static_cast<unsigned long long>(Low));
+  return result;
+}
+
+// Fingerprint of state.
+Fingerprint des::fingerprintState(const string& n, unsigned a) noexcept {
+  Hasher h;
+  h.add(state_tag);
+  h.add(n);
+  h.add(a);
+  return h.result();
+}
+
+// Fingerprint of event.
+Fingerprint des::fingerprintEvent(const string& n, EventType t) noexcept {
+  Hasher h;
+  h.add(event_tag);
+  h.add(n);
+  h.add(static_cast<unsigned>(t));
+  return h.result();
+}
+
+// Fingerprint of link.
+Fingerprint des::fingerprintLink(const string& s, const string& e, bool i, unsigned m) noexcept {
+  Hasher h;
+  h.add(i ? input_tag : output_tag);
+  h.add(s);
+  h.add(e);
+  h.add(m);
+  return h.result();
+}
@@ -0,0 +1,459 @@
+/*! @file graph_binary.cpp
+Binary format of reachability graphs and @ref des::MappedGraph class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "graph_binary.hpp"
+#include "marking_store.hpp"
+
+
+using namespace std;
+using namespace des;
+
+static_assert(sizeof(BinaryGraphHeader) == 152, "binary graph header must have fixed size");
+
+namespace {
+
+  // Alignment of sections.
+  const uint64_t section_alignment = 8;
+
+  // Max quantity of delta records between full marking records.
+  const uint8_t keyframe_distance = 16;
+
+  // Aligned offset.
+  uint64_t align(uint64_t n) noexcept {
+    return (n + section_alignment - 1) / section_alignment * section_alignment;
+  }
+
+  // Appending of LEB128 number.
+  void appendNumber(string& b, uint64_t n) {
+    while (n >= 0x80) {
+      b += static_cast<char>(n | 0x80);
+      n >>= 7;
+    }
+    b += static_cast<char>(n);
+  }
+
+  // Zigzag coding of signed difference.
+  uint64_t zigzag(int64_t n) noexcept {
+    return (static_cast<uint64_t>(n) << 1) ^ static_cast<uint64_t>(n >> 63);
+  }
+
+  // Decoding of zigzag-coded difference.
+  int64_t unzigzag(uint64_t n) noexcept {
+    return static_cast<int64_t>(n >> 1) ^ -static_cast<int64_t>(n & 1);
+  }
+
+  // Decoder of LEB128 numbers with bounds checks.
+  class Decoder {
+  public:
+    Decoder(const uint8_t* p, const uint8_t* e) noexcept : _p(p), _end(e) {}
+    uint64_t next() {
+      uint64_t result = 0;
+      for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (_p == _end) {
+          break;
+        }
+        const uint8_t byte = *_p++;
+        result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+          return result;
+        }
+      }
+      throw runtime_error("MappedGraph: record is damaged");
+    }
+    void skip(uint64_t n) {
+      for (; n; n--) {
+        next();
+      }
+    }
+    const uint8_t* position() const noexcept {
+      return _p;
+    }
+  private:
+    const uint8_t* _p;
+    const uint8_t* _end;
+  };
+
+  // Appending of changed states of marking record.
+  void appendChanges(string& b, const unsigned* m, const unsigned* base, size_t w, vector<uint32_t>& changed) {
+    changed.clear();
+    for (size_t s = 0; s < w; s++) {
+      if (m[s] != (base ? base[s] : 0)) {
+        changed.push_back(static_cast<uint32_t>(s));
+      }
+    }
+    appendNumber(b, changed.size());
+    uint32_t previous = 0;
+    for (const auto s : changed) {
+      appendNumber(b, s - previous);
+      appendNumber(b, m[s]);
+      previous = s;
+    }
+  }
+
+  // Checks quantity for 32-bit field.
+  uint32_t narrow(size_t n, const char* what) {
+    if (n > numeric_limits<uint32_t>::max()) {
+      throw length_error(string("writeBinaryGraph: quantity of ") + what + " exceeds 32-bit numbers");
+    }
+    return static_cast<uint32_t>(n);
+  }
+
+} // namespace
+
+// Writing into stream.
+BinaryGraphHeader des::writeBinaryGraph(ostream& o, const CompiledNet& n, const BinaryGraphOptions& p) {
+  if (!p.MaxStates || p.MaxStates > numeric_limits<uint32_t>::max()) {
+    throw invalid_argument("writeBinaryGraph: limit of nodes must be from 1 to UINT32_MAX");
+  }
+  BinaryGraphHeader h;
+  h.HeaderSize = sizeof(BinaryGraphHeader);
+  h.States = narrow(n.getStateQuantity(), "states");
+  h.Events = narrow(n.getEventQuantity(), "events");
+  h.Complete = 1;
+
+  string strings;
+  vector<BinaryString> state_names(h.States), event_names(h.Events);
+  for (size_t i = 0; i < h.States; i++) {
+    state_names[i] = { narrow(strings.size(), "name characters"), narrow(n.getStateName(i).size(), "name characters") };
+    strings += n.getStateName(i);
+  }
+  for (size_t t = 0; t < h.Events; t++) {
+    event_names[t] = { narrow(strings.size(), "name characters"), narrow(n.getEventName(t).size(), "name characters") };
+    strings += n.getEventName(t);
+  }
+
+  // breadth-first exploration, edge records are written after expansion of each node
+  MarkingStore store(h.States);
+  Marking current = n.getInitialMarking(), next(current.size());
+  store.insert(current);
+  string edges;
+  vector<uint64_t> edge_index;
+  vector<GraphEdge> found;
+  size_t layer_end = 1;
+  for (size_t i = 0; i < store.size(); i++) {
+    if (i == layer_end) {
+      h.Depth++;
+      layer_end = store.size();
+    }
+    if (i % binary_graph_block == 0) {
+      edge_index.push_back(edges.size());
+    }
+    store.get(i, current);
+    found.clear();
+    bool deadlock = true;
+    for (size_t t = 0; t < h.Events; t++) {
+      if (!n.isReady(current, t)) {
+        continue;
+      }
+      deadlock = false;
+      n.fire(current, t, next);
+      size_t target = store.find(next);
+      if (target == MarkingStore::none) {
+        if (store.size() >= p.MaxStates) {
+          h.Complete = 0;
+          continue;
+        }
+        target = store.insert(next, i, t).first;
+      }
+      found.push_back({ static_cast<uint32_t>(t), static_cast<uint32_t>(target) });
+    }
+    h.Deadlocks += deadlock;
+    h.Edges += found.size();
+    appendNumber(edges, found.size());
+    uint32_t previous = 0;
+    for (const auto& e : found) {
+      appendNumber(edges, e.Event - previous);
+      appendNumber(edges, zigzag(static_cast<int64_t>(e.Target) - static_cast<int64_t>(i)));
+      previous = e.Event;
+    }
+  }
+  h.Nodes = store.size();
+  edge_index.push_back(edges.size());
+
+  // marking records against parent markings with full records at most every keyframe_distance generations
+  string markings;
+  vector<uint64_t> marking_index;
+  vector<uint8_t> distance(store.size());
+  vector<uint32_t> changed;
+  for (size_t i = 0; i < store.size(); i++) {
+    if (i % binary_graph_block == 0) {
+      marking_index.push_back(markings.size());
+    }
+    const size_t parent = store.getParent(i);
+    const bool full = parent == MarkingStore::none || distance[parent] + 1 >= keyframe_distance;
+    distance[i] = full ? 0 : static_cast<uint8_t>(distance[parent] + 1);
+    appendNumber(markings, ((parent == MarkingStore::none ? 0 : i - parent) << 1) | (full ? 1 : 0));
+    appendChanges(markings, store.data(i), full ? nullptr : store.data(parent), h.States, changed);
+    const unsigned* m = store.data(i);
+    h.MaxTokens = max(h.MaxTokens, h.States ? *max_element(m, m + h.States) : 0u);
+  }
+  marking_index.push_back(markings.size());
+
+  // layout of sections
+  uint64_t end = sizeof(BinaryGraphHeader);
+  auto place = [&](uint64_t bytes) {
+    const uint64_t offset = align(end);
+    end = offset + bytes;
+    return offset;
+  };
+  h.Strings = place(strings.size());
+  h.StringBytes = strings.size();
+  h.StateNames = place(state_names.size() * sizeof(BinaryString));
+  h.EventNames = place(event_names.size() * sizeof(BinaryString));
+  h.EdgeIndex = place(edge_index.size() * sizeof(uint64_t));
+  h.EdgeData = place(edges.size());
+  h.EdgeBytes = edges.size();
+  h.MarkingIndex = place(marking_index.size() * sizeof(uint64_t));
+  h.MarkingData = place(markings.size());
+  h.MarkingBytes = markings.size();
+  h.FileSize = align(end);
+
+  uint64_t position = 0;
+  auto put = [&](uint64_t offset, const void* d, size_t s) {
+    static const char zeros[section_alignment] = {};
+    o.write(zeros, static_cast<streamsize>(offset - position));
+    o.write(static_cast<const char*>(d), static_cast<streamsize>(s));
+    position = offset + s;
+  };
+  put(0, &h, sizeof(h));
+  put(h.Strings, strings.data(), strings.size());
+  put(h.StateNames, state_names.data(), state_names.size() * sizeof(BinaryString));
+  put(h.EventNames, event_names.data(), event_names.size() * sizeof(BinaryString));
+  put(h.EdgeIndex, edge_index.data(), edge_index.size() * sizeof(uint64_t));
+  put(h.EdgeData, edges.data(), edges.size());
+  put(h.MarkingIndex, marking_index.data(), marking_index.size() * sizeof(uint64_t));
+  put(h.MarkingData, markings.data(), markings.size());
+  put(h.FileSize, nullptr, 0);
+  if (!o) {
+    throw runtime_error("writeBinaryGraph: writing error");
+  }
+  return h;
+}
+
+// Writing into file.
+BinaryGraphHeader des::writeBinaryGraphFile(const string& f, const CompiledNet& n, const BinaryGraphOptions& p) {
+  ofstream file(f, ios::binary | ios::trunc);
+  if (!file) {
+    throw runtime_error("writeBinaryGraphFile: file can't be created " + f);
+  }
+  const BinaryGraphHeader h = writeBinaryGraph(file, n, p);
+  file.close();
+  if (!file) {
+    throw runtime_error("writeBinaryGraphFile: file can't be written " + f);
+  }
+  return h;
+}
+
+// Constructor of des::MappedGraph object for file.
+MappedGraph::MappedGraph(const string& p) {
+#if defined(_WIN32)
+  ifstream f(p, ios::binary | ios::ate);
+  if (!f) {
+    throw runtime_error("MappedGraph: file can't be opened " + p);
+  }
+  const size_t size = static_cast<size_t>(f.tellg());
+  _buffer.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+  f.seekg(0);
+  if (!f.read(reinterpret_cast<char*>(_buffer.data()), static_cast<streamsize>(size))) {
+    throw runtime_error("MappedGraph: file can't be read " + p);
+  }
+  _data = reinterpret_cast<const char*>(_buffer.data());
+#else
+  const int fd = open(p.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw runtime_error("MappedGraph: file can't be opened " + p);
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(BinaryGraphHeader))) {
+    close(fd);
+    throw runtime_error("MappedGraph: file isn't a binary graph " + p);
+  }
+  const size_t size = static_cast<size_t>(st.st_size);
+  void* m = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (m == MAP_FAILED) {
+    throw runtime_error("MappedGraph: file can't be mapped " + p);
+  }
+  _data = static_cast<const char*>(m);
+  _mapped_size = size;
+#endif
+  try {
+    attach(size);
+  }
+  catch (...) {
+#if !defined(_WIN32)
+    munmap(const_cast<char*>(_data), _mapped_size);
+#endif
+    throw;
+  }
+}
+
+// Constructor of des::MappedGraph object for data in memory.
+MappedGraph::MappedGraph(const void* d, size_t s) : _data(static_cast<const char*>(d)) {
+  attach(s);
+}
+
+// Destructor of des::MappedGraph object.
+MappedGraph::~MappedGraph() {
+#if !defined(_WIN32)
+  if (_mapped_size) {
+    munmap(const_cast<char*>(_data), _mapped_size);
+  }
+#endif
+}
+
+// Edges of node.
+void MappedGraph::getEdges(size_t i, vector<GraphEdge>& e) const {
+  Decoder d(locate(i, _edge_index, _edges, _header->EdgeBytes, true), _edges + _header->EdgeBytes);
+  const uint64_t count = d.next();
+  if (count > _header->Events) {
+    throw runtime_error("MappedGraph: record is damaged");
+  }
+  e.resize(count);
+  uint64_t event = 0;
+  for (auto& x : e) {
+    event += d.next();
+    const int64_t target = static_cast<int64_t>(i) + unzigzag(d.next());
+    if (event >= _header->Events || target < 0 || static_cast<uint64_t>(target) >= _header->Nodes) {
+      throw runtime_error("MappedGraph: record is damaged");
+    }
+    x = { static_cast<uint32_t>(event), static_cast<uint32_t>(target) };
+  }
+}
+
+// Marking of node.
+void MappedGraph::getMarking(size_t i, Marking& m) const {
+  // records from the node to the nearest full record of its ancestors
+  const uint8_t* chain[keyframe_distance + 1];
+  size_t length = 0;
+  for (size_t k = i;;) {
+    const uint8_t* record = locate(k, _marking_index, _markings, _header->MarkingBytes, false);
+    Decoder d(record, _markings + _header->MarkingBytes);
+    const uint64_t head = d.next();
+    if (length == keyframe_distance + 1 || (head >> 1) > k || (!(head & 1) && (head >> 1) == 0)) {
+      throw runtime_error("MappedGraph: record is damaged");
+    }
+    chain[length++] = record;
+    if (head & 1) {
+      break;
+    }
+    k -= head >> 1;
+  }
+  m.assign(_header->States, 0);
+  while (length) {
+    Decoder d(chain[--length], _markings + _header->MarkingBytes);
+    d.next();
+    const uint64_t count = d.next();
+    uint64_t state = 0;
+    for (uint64_t c = 0; c < count; c++) {
+      state += d.next();
+      const uint64_t tokens = d.next();
+      if (state >= _header->States || tokens > numeric_limits<unsigned>::max()) {
+        throw runtime_error("MappedGraph: record is damaged");
+      }
+      m[state] = static_cast<unsigned>(tokens);
+    }
+  }
+}
+
+// Parent of node.
+size_t MappedGraph::getParent(size_t i) const {
+  Decoder d(locate(i, _marking_index, _markings, _header->MarkingBytes, false), _markings + _header->MarkingBytes);
+  const uint64_t distance = d.next() >> 1;
+  if (distance > i) {
+    throw runtime_error("MappedGraph: record is damaged");
+  }
+  return distance ? i - distance : none;
+}
+
+// Record of node.
+const uint8_t* MappedGraph::locate(size_t i, const uint64_t* index, const uint8_t* data, uint64_t bytes,
+  bool edges) const {
+  if (i >= _header->Nodes) {
+    throw out_of_range("MappedGraph: node number is out of range");
+  }
+  Decoder d(data + index[i / binary_graph_block], data + bytes);
+  for (size_t k = i % binary_graph_block; k; k--) {
+    if (!edges) {
+      d.next(); // parent distance
+    }
+    d.skip(2 * d.next());
+  }
+  return d.position();
+}
+
+// Check of the header and index sections.
+void MappedGraph::attach(size_t s) {
+  auto fail = [](const string& m) {
+    throw runtime_error("MappedGraph: " + m);
+  };
+  if (s < sizeof(BinaryGraphHeader) || reinterpret_cast<uintptr_t>(_data) % section_alignment) {
+    fail("data isn't a binary graph");
+  }
+  _header = reinterpret_cast<const BinaryGraphHeader*>(_data);
+  const BinaryGraphHeader& h = *_header;
+  if (memcmp(h.Magic, BinaryGraphHeader().Magic, sizeof(h.Magic)) != 0) {
+    fail("data isn't a binary graph");
+  }
+  if (h.ByteOrder != BinaryGraphHeader().ByteOrder) {
+    fail("byte order of binary graph isn't supported");
+  }
+  if (h.Version != binary_graph_version || h.HeaderSize != sizeof(BinaryGraphHeader)) {
+    fail("version " + to_string(h.Version) + " of binary graph isn't supported");
+  }
+  if (h.FileSize != s) {
+    fail("binary graph is truncated");
+  }
+  if (h.Nodes == 0 || h.Nodes > none) {
+    fail("invalid quantity of nodes");
+  }
+  // returns pointer to section after check of its bounds
+  auto section = [&](uint64_t offset, uint64_t count, size_t size) {
+    if (offset % section_alignment || offset > s || count > (s - offset) / size) {
+      fail("section is out of data");
+    }
+    return _data + offset;
+  };
+  const uint64_t blocks = (h.Nodes + binary_graph_block - 1) / binary_graph_block + 1;
+  _strings = section(h.Strings, h.StringBytes, 1);
+  _state_names = reinterpret_cast<const BinaryString*>(section(h.StateNames, h.States, sizeof(BinaryString)));
+  _event_names = reinterpret_cast<const BinaryString*>(section(h.EventNames, h.Events, sizeof(BinaryString)));
+  _edge_index = reinterpret_cast<const uint64_t*>(section(h.EdgeIndex, blocks, sizeof(uint64_t)));
+  _edges = reinterpret_cast<const uint8_t*>(section(h.EdgeData, h.EdgeBytes, 1));
+  _marking_index = reinterpret_cast<const uint64_t*>(section(h.MarkingIndex, blocks, sizeof(uint64_t)));
+  _markings = reinterpret_cast<const uint8_t*>(section(h.MarkingData, h.MarkingBytes, 1));
+
+  for (const auto& names : { make_pair(_state_names, h.States), make_pair(_event_names, h.Events) }) {
+    for (size_t i = 0; i < names.second; i++) {
+      const BinaryString& r = names.first[i];
+      if (r.Offset > h.StringBytes || r.Length > h.StringBytes - r.Offset) {
+        fail("name is out of string table");
+      }
+    }
+  }
+  for (const auto& index : { make_pair(_edge_index, h.EdgeBytes), make_pair(_marking_index, h.MarkingBytes) }) {
+    if (index.first[0] != 0 || index.first[blocks - 1] != index.second) {
+      fail("invalid index of records");
+    }
+    for (size_t b = 1; b < blocks; b++) {
+      if (index.first[b - 1] > index.first[b]) {
+        fail("invalid index of records");
+      }
+    }
+  }
+}
@@ -0,0 +1,251 @@
+/*! @file graph_export.cpp
+@ref des::GraphExporter class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <charconv>
+#include <filesystem>
+#include <stdexcept>
+
+#include "graph_export.hpp"
+#include "splitmix.hpp"
+
+
+using namespace std;
+using namespace des;
+namespace fs = std::filesystem;
+
+namespace {
+
+  const size_t buffer_size = 1 << 20; // the buffer is written into the file after this size
+
+  // Threshold of sampling hashes for probability of keeping a node.
+  uint64_t threshold(double p) noexcept {
+    if (p <= 0.0) {
+      return 0;
+    }
+    const double t = p * 0x1p64;
+    return t >= 0x1p64 ? UINT64_MAX : static_cast<uint64_t>(t);
+  }
+
+  // Appending of number.
+  void appendNumber(string& b, uint64_t n) {
+    char digits[24];
+    b.append(digits, to_chars(digits, digits + sizeof(digits), n).ptr);
+  }
+
+  // Appending of node name.
+  void appendNode(string& b, uint64_t n) {
+    b += 'm';
+    appendNumber(b, n);
+  }
+
+  // Appending of marking label, states without tokens are skipped.
+  void appendMarking(string& b, const map<string, int>& m) {
+    bool first = true;
+    for (const auto& s : m) {
+      if (s.second == 0) {
+        continue;
+      }
+      if (!first) {
+        b += ' ';
+      }
+      first = false;
+      b.append(s.first).append(1, '=');
+      if (s.second < 0) {
+        b.append("ω");
+      }
+      else {
+        appendNumber(b, static_cast<uint64_t>(s.second));
+      }
+    }
+  }
+
+} // namespace
+
+// Constructor of des::GraphExporter object.
+GraphExporter::GraphExporter(const string& p, const GraphExportOptions& o) : _options(o), _path(p),
+  _threshold(threshold(o.Sampling)) {
+  _buffer.reserve(buffer_size + 4096);
+  open();
+}
+
+// Destructor of des::GraphExporter object.
+GraphExporter::~GraphExporter() {
+  try {
+    close();
+  }
+  catch (...) {
+  }
+}
+
+// Node addition.
+void GraphExporter::addNode(uint64_t n, const map<string, int>& m) {
+  if (_closed || !kept(n)) {
+    return;
+  }
+  if (_options.MaxNodes && _nodes == _options.MaxNodes) {
+    _cutoff = n ? n - 1 : 0; // identifiers increase, so all next nodes are dropped
+    _truncated = true;
+    return;
+  }
+  switch (_options.Format) {
+    case GraphFormat::dot:
+      _buffer += '\t';
+      appendNode(_buffer, n);
+      if (_options.Markings) {
+        _buffer += " [label=\"";
+        appendMarking(_buffer, m);
+        _buffer += "\"]";
+      }
+      _buffer += '\n';
+      break;
+    case GraphFormat::graphml:
+      _buffer += "    <node id=\"";
+      appendNode(_buffer, n);
+      if (_options.Markings) {
+        _buffer += "\"><data key=\"marking\">";
+        appendMarking(_buffer, m);
+        _buffer += "</data></node>\n";
+      }
+      else {
+        _buffer += "\"/>\n";
+      }
+      break;
+    case GraphFormat::csv: // the edge list has no nodes
+      break;
+  }
+  if (_file_first == UINT64_MAX) {
+    _file_first = n;
+  }
+  _nodes++;
+  commit();
+}
+
+// Edge addition.
+void GraphExporter::addEdge(uint64_t s, uint64_t t, const string& e) {
+  if (_closed || !kept(s) || !kept(t)) {
+    return;
+  }
+  if (_options.MaxEdges && _edges == _options.MaxEdges) {
+    _truncated = true;
+    return;
+  }
+  switch (_options.Format) {
+    case GraphFormat::dot:
+      _buffer += '\t';
+      appendNode(_buffer, s);
+      _buffer += " -> ";
+      appendNode(_buffer, t);
+      _buffer.append(" [label=\"").append(e).append("\"]\n");
+      break;
+    case GraphFormat::graphml: // nodes of edges must be declared in the same document
+      stub(s);
+      stub(t);
+      _buffer += "    <edge source=\"";
+      appendNode(_buffer, s);
+      _buffer += "\" target=\"";
+      appendNode(_buffer, t);
+      _buffer.append("\"><data key=\"event\">").append(e).append("</data></edge>\n");
+      break;
+    case GraphFormat::csv:
+      appendNumber(_buffer, s);
+      _buffer += ',';
+      appendNumber(_buffer, t);
+      _buffer.append(1, ',').append(e).append(1, '\n');
+      break;
+  }
+  _edges++;
+  commit();
+}
+
+// Closing of the last file.
+void GraphExporter::close() {
+  if (!_closed) {
+    _closed = true;
+    finish();
+  }
+}
+
+// Check of node.
+bool GraphExporter::kept(uint64_t n) const noexcept {
+  if (n > _cutoff) {
+    return false;
+  }
+  return n == 0 || _threshold == UINT64_MAX || mix64((n ^ _options.Seed) + golden_gamma) < _threshold;
+}
+
+// Opening of the next file.
+void GraphExporter::open() {
+  string path = _path;
+  if (!_files.empty()) {
+    const fs::path p(_path);
+    path = (p.parent_path() / p.stem()).string() + "." + to_string(_files.size()) + p.extension().string();
+  }
+  _file.open(path, ios::binary | ios::trunc);
+  if (!_file) {
+    throw runtime_error("GraphExporter: file can't be opened " + path);
+  }
+  _files.push_back(path);
+  _file_size = 0;
+  _file_first = UINT64_MAX;
+  _stubs.clear();
+  switch (_options.Format) {
+    case GraphFormat::dot:
+      _buffer += "digraph ReachabilityGraph {\n";
+      break;
+    case GraphFormat::graphml:
+      _buffer += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n"
+        "  <key id=\"marking\" for=\"node\" attr.name=\"marking\" attr.type=\"string\"/>\n"
+        "  <key id=\"event\" for=\"edge\" attr.name=\"event\" attr.type=\"string\"/>\n"
+        "  <graph id=\"ReachabilityGraph\" edgedefault=\"directed\">\n";
+      break;
+    case GraphFormat::csv:
+      _buffer += "source,target,event\n";
+      break;
+  }
+}
+
+// Completion of the current file.
+void GraphExporter::finish() {
+  switch (_options.Format) {
+    case GraphFormat::dot:
+      _buffer += "}\n";
+      break;
+    case GraphFormat::graphml:
+      _buffer += "  </graph>\n</graphml>\n";
+      break;
+    case GraphFormat::csv:
+      break;
+  }
+  _file.write(_buffer.data(), static_cast<streamsize>(_buffer.size()));
+  _buffer.clear();
+  _file.close();
+  if (!_file) {
+    throw runtime_error("GraphExporter: file can't be written " + _files.back());
+  }
+}
+
+// Writing of the buffer.
+void GraphExporter::commit() {
+  const bool full = _options.MaxFileSize && _file_size + _buffer.size() >= _options.MaxFileSize;
+  if (full) {
+    finish();
+    open();
+  }
+  else if (_buffer.size() >= buffer_size) {
+    _file.write(_buffer.data(), static_cast<streamsize>(_buffer.size()));
+    _file_size += _buffer.size();
+    _buffer.clear();
+  }
+}
+
+// Node of earlier file for an edge end.
+void GraphExporter::stub(uint64_t n) {
+  if (n < _file_first && _stubs.insert(n).second) { // identifiers increase, so less nodes are in earlier files
+    _buffer += "    <node id=\"";
+    appendNode(_buffer, n);
+    _buffer += "\"/>\n";
+  }
+}
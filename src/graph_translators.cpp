@@ -3,6 +3,8 @@ Translator functions cpp file.
 @authors A. Kozov
 @date 2021/08/29 */
 
+#include <charconv>
+
 #include "graph_translators.hpp"
 
 #define HEADER_STRING "# DES model generated file v0.1"
@@ -32,77 +34,142 @@ Translator functions cpp file.
 
 #define ARC_TO_TRANSITION_NUMBER(p, t) "\t\"p_" << p << "\" -> \"" << "t_" << t << "\""
 #define ARC_TO_PLACE_NUMBER(t, p) "\t\"t_" << t << "\" -> \"" << "p_" << p << "\""
+#define ARC_MULTIPLICITY(m) "[label=\"" << m << "\"]"
 
 
 using namespace std;
 using namespace des;
 
 
-//std::string translateAutomationToDOT(const Automation& a) {
-//  stringstream s;
-//  s << a;
-//  return s.str();
-//}
+namespace {
+
+  // Buffer of DOT description, it writes large blocks into the stream and flushes it once.
+  class Writer {
+  public:
+
+    // Size of the buffer.
+    static const size_t capacity = 1 << 20;
+
+    explicit Writer(ostream& o) : _o(o) {
+      _buffer.reserve(capacity);
+    }
+
+    ~Writer() {
+      write();
+      _o.flush();
+    }
+
+    Writer& operator<<(const char* s) {
+      return append(s, char_traits<char>::length(s));
+    }
+
+    Writer& operator<<(const string& s) {
+      return append(s.data(), s.size());
+    }
+
+    Writer& operator<<(unsigned n) {
+      char digits[16];
+      return append(digits, static_cast<size_t>(to_chars(digits, digits + sizeof(digits), n).ptr - digits));
+    }
+
+  private:
+
+    Writer& append(const char* s, size_t n) {
+      if (_buffer.size() + n > capacity) {
+        write();
+      }
+      _buffer.append(s, n);
+      return *this;
+    }
+
+    void write() {
+      _o.write(_buffer.data(), static_cast<streamsize>(_buffer.size()));
+      _buffer.clear();
+    }
+
+    ostream& _o;
+    string _buffer;
+
+  };
+
+  // End of arc with multiplicity label, if the multiplicity isn't 1.
+  void closeArc(Writer& w, unsigned m) {
+    if (m > 1) {
+      w << ARC_MULTIPLICITY(m);
+    }
+    w << "\n";
+  }
+
+} // namespace
 
 // Stream output.
 ostream& des::operator<<(ostream& o, const Automation& a) {
-  o << HEADER_STRING << endl;
+  Writer w(o);
+  w << HEADER_STRING << "\n";
   // add net
-  o << DIGRAPH_OPEN << endl;
+  w << DIGRAPH_OPEN << "\n";
   // add places
-  o << PLACE_OPEN << endl;
-  for (const auto& state : a.getStateNameSet()) {
+  w << PLACE_OPEN << "\n";
+  for (const auto& entry : a._states) {
+    const string& state = entry.first;
     auto index = state.find_first_of('/');
     if (index != string::npos) {
-      o << PLACE_INDEX_SUP_SUB(state, "p", string(state, 0, index), string(state, index + 1));
+      w << PLACE_INDEX_SUP_SUB(state, "p", string(state, 0, index), string(state, index + 1));
     } else {
-      o << PLACE_INDEX_SUB(state, "p", state);
+      w << PLACE_INDEX_SUB(state, "p", state);
     }
-    const unsigned t = a.getActivity(state);
+    const unsigned t = entry.second.Component.activity();
     if (t > 0) {
-      o << TOKEN(t);
+      w << TOKEN(t);
     }
-    o << endl;
+    w << "\n";
   }
-  o << PLACE_CLOSE << endl; // close subgraph place
+  w << PLACE_CLOSE << "\n"; // close subgraph place
   // add transitions
-  o << TRANSITION_OPEN << endl;
-  for (const auto& t : a.getEventNameSet()) {
-    const auto& event = a.getEventCopy(t);
+  w << TRANSITION_OPEN << "\n";
+  for (const auto& entry : a._events) {
+    const string& t = entry.first;
+    const Event& event = entry.second.Component;
     auto index = t.find_first_of('/');
-    if (a.getType(t) != EventType::macro) {
+    if (event.type() != EventType::macro) {
       if (index != string::npos) {
-        o << TRANSITION_INDEX_SUP_SUB(t, "t", string(t, 0, index), string(t, index + 1));
+        w << TRANSITION_INDEX_SUP_SUB(t, "t", string(t, 0, index), string(t, index + 1));
       } else {
-        o << TRANSITION_INDEX_SUB(t, "t", t);
+        w << TRANSITION_INDEX_SUB(t, "t", t);
       }
       // colors for type
-      if (a.getType(t) == EventType::uncontrollable) {
-        o << COLOR_LABEL("coral");
-      } else if (a.getType(t) == EventType::controllable) {
-        o << COLOR_LABEL("cornflowerblue");
+      if (event.type() == EventType::uncontrollable) {
+        w << COLOR_LABEL("coral");
+      } else if (event.type() == EventType::controllable) {
+        w << COLOR_LABEL("cornflowerblue");
       }
     } else { // macro
-      o << MACRO_EVENT_OPEN(t) << endl; // todo
+      w << MACRO_EVENT_OPEN(t) << "\n"; // todo
       for (const auto& n : event.getMaskedEvents()) {
-        o << MASKED_EVENT(n) << endl;
+        w << MASKED_EVENT(n) << "\n";
       }
-      o << MACRO_EVENT_CLOSE;
+      w << MACRO_EVENT_CLOSE;
     }
-    o << endl;
+    w << "\n";
   }
-  o << TRANSITION_CLOSE << endl; // close subgraph transition
-  // add arcs
-  for (const auto& p : a.getStateNameSet()) {
-    for (const auto& t : a.getEventNameSet()) {
-      for (unsigned i = 0; i < a.getLinksFromStateToEvent(p, t); i++) {
-        o << ARC_TO_TRANSITION_NUMBER(p, t) << endl;
-      }
-      for (unsigned i = 0; i < a.getLinksFromEventToState(t, p); i++) {
-        o << ARC_TO_PLACE_NUMBER(t, p) << endl;
+  w << TRANSITION_CLOSE << "\n"; // close subgraph transition
+  // add arcs, links of each state are merged in order of event names
+  for (const auto& entry : a._states) {
+    const string& p = entry.first;
+    auto output = entry.second.Outputs.begin(), input = entry.second.Inputs.begin();
+    const auto outputs_end = entry.second.Outputs.end(), inputs_end = entry.second.Inputs.end();
+    while (output != outputs_end || input != inputs_end) {
+      if (input == inputs_end || (output != outputs_end && output->first <= input->first)) {
+        w << ARC_TO_TRANSITION_NUMBER(p, output->first);
+        closeArc(w, output->second);
+        output++;
+      } else {
+        w << ARC_TO_PLACE_NUMBER(input->first, p);
+        closeArc(w, input->second);
+        input++;
       }
     }
   }
-  o << DIGRAPH_CLOSE << endl; // close digraph PN
+  w << DIGRAPH_CLOSE << "\n"; // close digraph PN
   return  o;
 }
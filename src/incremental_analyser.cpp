@@ -0,0 +1,259 @@
+/*! @file incremental_analyser.cpp
+@ref des::IncrementalAnalyser class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <map>
+#include <set>
+#include <tuple>
+
+#include "incremental_analyser.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // The least name of states and events, the connectivity search of Analyser starts from it.
+  string rootName(const Automation& a) {
+    const auto states = a.getStateNameSet(), events = a.getEventNameSet();
+    if (states.empty() || events.empty()) {
+      return states.empty() ? (events.empty() ? string() : *events.begin()) : *states.begin();
+    }
+    return min(*states.begin(), *events.begin());
+  }
+
+  // True for a state and an event linked in any direction.
+  bool adjacent(const Automation& a, const string& s, const string& e) {
+    return a.getLinksFromStateToEvent(s, e) || a.getLinksFromEventToState(e, s);
+  }
+
+} // namespace
+
+// Constructor of des::IncrementalAnalyser object.
+IncrementalAnalyser::IncrementalAnalyser(const AnalysisOptions& o) : _options(o) {
+}
+
+// Analysis or update.
+const AnalysisResult& IncrementalAnalyser::analyse(const Automation& a) {
+  if (_base) {
+    if (const auto changes = a.getChangesSince(*_base)) {
+      if (changes->empty() || update(a, *changes)) {
+        _base.emplace(a);
+        _statistics.Updates++;
+        return _result;
+      }
+    }
+  }
+  analyseAnew(a);
+  return _result;
+}
+
+// Reset of the previous result.
+void IncrementalAnalyser::reset() noexcept {
+  _base.reset();
+}
+
+// Local update of the result.
+bool IncrementalAnalyser::update(const Automation& a, const vector<Change>& c) {
+  if (_result.inconclusive()) {
+    return false;
+  }
+  const Automation& b = *_base;
+
+  // changed components and links, only the final values of them matter
+  set<string> states, events;
+  set<tuple<string, string, bool>> links;
+  for (const auto& x : c) {
+    switch (x.Kind) {
+      case ChangeKind::addState:
+      case ChangeKind::removeState:
+      case ChangeKind::changeState:
+        states.insert(x.State);
+        break;
+      case ChangeKind::addEvent:
+      case ChangeKind::removeEvent:
+      case ChangeKind::changeEvent:
+        events.insert(x.Event);
+        break;
+      case ChangeKind::setInputLink:
+      case ChangeKind::setOutputLink:
+        links.emplace(x.State, x.Event, x.Kind == ChangeKind::setInputLink);
+        states.insert(x.State);
+        events.insert(x.Event);
+        break;
+    }
+  }
+  for (const auto* names : { &states, &events }) {
+    for (const auto& n : *names) {
+      if ((a.checkState(n) && a.checkEvent(n)) || (b.checkState(n) && b.checkEvent(n))) {
+        return false; // the connectivity search merges a state and an event with the same name
+      }
+    }
+  }
+
+  // events, which never fire in the changed net
+  auto wasDead = [&](const string& e) {
+    return _result.DeadEvents.find(e) != _result.DeadEvents.end();
+  };
+  set<string> added_events, removed_events;
+  for (const auto& e : events) {
+    const bool before = b.checkEvent(e), after = a.checkEvent(e);
+    if (before && !after) {
+      if (!wasDead(e)) {
+        return false;
+      }
+      removed_events.insert(e);
+    }
+    else if (!before && after) {
+      if (a.getEventInputLinksQuantity(e) || a.getEventOutputLinksQuantity(e)) {
+        return false;
+      }
+      added_events.insert(e);
+    }
+  }
+  auto isDead = [&](const string& e) {
+    return wasDead(e) || added_events.find(e) != added_events.end();
+  };
+
+  // links can be changed for events, which never fire
+  vector<pair<string, string>> added_links, removed_links;
+  for (const auto& l : links) {
+    const auto& [s, e, input] = l;
+    const unsigned before = input ? b.getLinksFromStateToEvent(s, e) : b.getLinksFromEventToState(e, s);
+    const unsigned after = input ? a.getLinksFromStateToEvent(s, e) : a.getLinksFromEventToState(e, s);
+    if (before == after) {
+      continue;
+    }
+    if (removed_events.find(e) == removed_events.end() && (!wasDead(e) || (input && after < before))) {
+      return false; // the event can fire or change markings
+    }
+    if (input && !before && (!b.checkEvent(e) || !b.getEventInputLinksQuantity(e))) {
+      return false; // the event without input links is dead, but it can fire after addition of an input link
+    }
+    if (!before && !adjacent(b, s, e)) {
+      added_links.emplace_back(s, e);
+    }
+    else if (!after && !adjacent(a, s, e)) {
+      removed_links.emplace_back(s, e);
+    }
+  }
+
+  // states keep their tokens in all markings or get the same shift of tokens
+  set<string> added_states, removed_states;
+  map<string, long long> shifts;
+  for (const auto& s : states) {
+    const bool before = b.checkState(s), after = a.checkState(s);
+    if (before && !after) {
+      removed_states.insert(s);
+    }
+    else if (!before && after) {
+      added_states.insert(s);
+    }
+    else if (before && after && a.getActivity(s) != b.getActivity(s)) {
+      const long long shift = static_cast<long long>(a.getActivity(s)) - b.getActivity(s);
+      for (const auto& e : a.getStateOutputs(s)) {
+        if (shift > 0 || !isDead(e)) {
+          return false;
+        }
+      }
+      shifts.emplace(s, shift);
+    }
+  }
+
+  // verdicts are kept, witnesses and dead events are updated
+  for (auto* w : { &_result.Deadlock, &_result.Unbounded }) {
+    if (*w) {
+      auto& m = (*w)->Marking;
+      for (const auto& s : removed_states) {
+        m.erase(s);
+      }
+      for (const auto& s : added_states) {
+        m[s] = a.getActivity(s);
+      }
+      for (const auto& s : shifts) {
+        auto& tokens = m[s.first];
+        if (tokens != omega) {
+          tokens = static_cast<unsigned>(tokens + s.second);
+        }
+      }
+    }
+  }
+  for (const auto& e : removed_events) {
+    _result.DeadEvents.erase(e);
+  }
+  _result.DeadEvents.insert(added_events.begin(), added_events.end());
+  if (!_result.Deadlock) {
+    _result.Alive = _result.DeadEvents.empty() ? Verdict::yes : Verdict::no;
+  }
+
+  // connectivity of the main component, which contains the least name
+  auto& disconnected = _result.Disconnected;
+  auto inMain = [&](const string& n) {
+    return disconnected.find(n) == disconnected.end();
+  };
+  bool recompute = !a.checkState(_root) && !a.checkEvent(_root);
+  for (const auto* names : { &added_states, &added_events }) {
+    for (const auto& n : *names) {
+      recompute = recompute || n < _root;
+    }
+  }
+  for (const auto* names : { &removed_states, &removed_events }) {
+    for (const auto& n : *names) {
+      recompute = recompute || inMain(n);
+    }
+  }
+  for (const auto& l : removed_links) {
+    recompute = recompute || (inMain(l.first) && inMain(l.second));
+  }
+  if (recompute) {
+    recomputeConnectivity(a);
+    return true;
+  }
+  for (const auto* names : { &removed_states, &removed_events }) {
+    for (const auto& n : *names) {
+      disconnected.erase(n);
+    }
+  }
+  for (const auto* names : { &added_states, &added_events }) {
+    disconnected.insert(names->begin(), names->end());
+  }
+  for (const auto& l : added_links) {
+    if (inMain(l.first) == inMain(l.second)) {
+      continue;
+    }
+    vector<string> queue(1, inMain(l.first) ? l.second : l.first); // the other component joins the main one
+    disconnected.erase(queue.front());
+    while (!queue.empty()) {
+      const string n = std::move(queue.back());
+      queue.pop_back();
+      const bool state = a.checkState(n);
+      for (const auto& neighbours : { state ? a.getStateInputs(n) : a.getEventInputs(n),
+        state ? a.getStateOutputs(n) : a.getEventOutputs(n) }) {
+        for (const auto& x : neighbours) {
+          if (disconnected.erase(x)) {
+            queue.push_back(x);
+          }
+        }
+      }
+    }
+  }
+  _result.Coherent = disconnected.empty() ? Verdict::yes : Verdict::no;
+  return true;
+}
+
+// Analysis of the whole state space.
+void IncrementalAnalyser::analyseAnew(const Automation& a) {
+  _result = _analyser.run_analyse(a, _options);
+  _root = rootName(a);
+  _base.emplace(a);
+  _statistics.FullAnalyses++;
+}
+
+// Connectivity search over the whole net.
+void IncrementalAnalyser::recomputeConnectivity(const Automation& a) {
+  _result.Coherent = _analyser.bfs(a, _result.Disconnected) ? Verdict::yes : Verdict::no;
+  _root = rootName(a);
+  _statistics.ConnectivityRecomputations++;
+}
@@ -0,0 +1,106 @@
+/*! @file marking_store.cpp
+@ref des::MarkingStore class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "marking_store.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Initial quantity of hash table slots.
+  const size_t initial_table_size = 1024;
+
+} // namespace
+
+// Constructor of des::MarkingStore object.
+MarkingStore::MarkingStore(size_t w) : _width(w), _markings(), _parents(), _events(), _table(initial_table_size, 0) {
+}
+
+// Marking addition.
+pair<size_t, bool> MarkingStore::insert(const Marking& m, size_t p, size_t e) {
+  const size_t mask = _table.size() - 1;
+  size_t slot = hash(m.data()) & mask;
+  while (_table[slot]) {
+    if (memcmp(data(_table[slot] - 1), m.data(), _width * sizeof(unsigned)) == 0) {
+      return { _table[slot] - 1, false };
+    }
+    slot = (slot + 1) & mask;
+  }
+  if (size() >= none - 1) {
+    throw length_error("insert: quantity of markings exceeds 32-bit numbers");
+  }
+  const size_t i = size();
+  _markings.insert(_markings.end(), m.begin(), m.begin() + static_cast<ptrdiff_t>(_width));
+  _parents.push_back(static_cast<uint32_t>(p));
+  _events.push_back(static_cast<uint32_t>(e));
+  _table[slot] = static_cast<uint32_t>(i + 1);
+  if (2 * size() > _table.size()) {
+    grow(); // load factor is at most one half
+  }
+  return { i, true };
+}
+
+// Marking search.
+size_t MarkingStore::find(const Marking& m) const noexcept {
+  const size_t mask = _table.size() - 1;
+  for (size_t slot = hash(m.data()) & mask; _table[slot]; slot = (slot + 1) & mask) {
+    if (memcmp(data(_table[slot] - 1), m.data(), _width * sizeof(unsigned)) == 0) {
+      return _table[slot] - 1;
+    }
+  }
+  return none;
+}
+
+// Marking copy.
+void MarkingStore::get(size_t i, Marking& m) const {
+  m.assign(data(i), data(i) + _width);
+}
+
+// Firing sequence from the first marking.
+vector<size_t> MarkingStore::getPath(size_t i) const {
+  vector<size_t> result;
+  for (size_t n = i; getParent(n) != none; n = getParent(n)) {
+    result.push_back(getEvent(n));
+  }
+  reverse(result.begin(), result.end());
+  return result;
+}
+
+// Allocated memory.
+size_t MarkingStore::memory() const noexcept {
+  return _markings.capacity() * sizeof(unsigned) + (_parents.capacity() + _events.capacity()) * sizeof(uint32_t) +
+    _table.capacity() * sizeof(uint32_t);
+}
+
+// Hash of marking (FNV-1a over token quantities with final mixing).
+uint64_t MarkingStore::hash(const unsigned* m) const noexcept {
+  uint64_t h = 14695981039346656037ull;
+  for (size_t i = 0; i < _width; i++) {
+    h = (h ^ m[i]) * 1099511628211ull;
+  }
+  h ^= h >> 32;
+  h *= 0xd6e8feb86659fd93ull;
+  return h ^ (h >> 32);
+}
+
+// Hash table doubling.
+void MarkingStore::grow() {
+  vector<uint32_t> table(_table.size() * 2, 0);
+  const size_t mask = table.size() - 1;
+  for (size_t i = 0; i < size(); i++) {
+    size_t slot = hash(data(i)) & mask;
+    while (table[slot]) {
+      slot = (slot + 1) & mask;
+    }
+    table[slot] = static_cast<uint32_t>(i + 1);
+  }
+  _table.swap(table);
+}
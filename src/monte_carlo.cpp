@@ -0,0 +1,124 @@
+/*! @file monte_carlo.cpp
+@ref des::MonteCarloRunner class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "monte_carlo.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Counters of runs of one thread, aligned to separate cache lines of threads.
+  struct alignas(64) Accumulator {
+    size_t Deadlocks = 0;           // quantity of runs stopped in a deadlock
+    uint64_t Steps = 0;             // quantity of fired events
+    uint64_t Markings = 0;          // quantity of visited markings
+    vector<uint64_t> Firings;       // quantities of firings of events
+    vector<uint64_t> TokenSums;     // sums of token quantities of states
+  };
+
+} // namespace
+
+// Constructor of des::MonteCarloRunner object.
+MonteCarloRunner::MonteCarloRunner(const CompiledNet& n, const MonteCarloOptions& o) : _net(n), _options(o) {
+}
+
+// Parallel simulation of all runs.
+MonteCarloResult MonteCarloRunner::run() const {
+  unsigned threads = _options.Threads ? _options.Threads : max(1u, thread::hardware_concurrency());
+  threads = static_cast<unsigned>(max<size_t>(1, min<size_t>(threads, _options.Runs)));
+  vector<Simulator> simulators;
+  vector<Accumulator> accumulators(threads);
+  simulators.reserve(threads);
+  for (unsigned t = 0; t < threads; t++) { // all memory is allocated before the threads start
+    simulators.emplace_back(_net, _options.Simulation);
+    accumulators[t].Firings.assign(_net.getEventQuantity(), 0);
+    accumulators[t].TokenSums.assign(_net.getStateQuantity(), 0);
+  }
+  atomic<size_t> next(0);
+
+  auto worker = [&](unsigned t) {
+    Simulator& simulator = simulators[t];
+    Accumulator& a = accumulators[t];
+    vector<uint64_t> sums(_net.getStateQuantity());
+    for (size_t r = next++; r < _options.Runs; r = next++) {
+      simulator.reset(r);
+      const uint64_t steps = simulator.run(_options.Steps).Steps;
+      a.Deadlocks += simulator.getReadyQuantity() == 0 ? 1 : 0;
+      a.Steps += steps;
+      a.Markings += steps + 1;
+      const auto& firings = simulator.getFiringCounts();
+      for (size_t e = 0; e < firings.size(); e++) {
+        a.Firings[e] += firings[e];
+      }
+      simulator.getTokenSums(sums);
+      for (size_t s = 0; s < sums.size(); s++) {
+        a.TokenSums[s] += sums[s];
+      }
+    }
+  };
+  const auto start = chrono::steady_clock::now();
+  vector<thread> pool;
+  pool.reserve(threads - 1);
+  try {
+    for (unsigned t = 1; t < threads; t++) { // the current thread runs simulations too
+      pool.emplace_back(worker, t);
+    }
+  }
+  catch (...) { // started threads take no more runs
+    next = _options.Runs;
+    for (auto& t : pool) {
+      t.join();
+    }
+    throw;
+  }
+  worker(0);
+  for (auto& t : pool) {
+    t.join();
+  }
+
+  MonteCarloResult result;
+  result.Seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  result.Runs = _options.Runs;
+  result.Firings.assign(_net.getEventQuantity(), 0);
+  vector<uint64_t> token_sums(_net.getStateQuantity(), 0);
+  uint64_t markings = 0;
+  for (const auto& a : accumulators) { // integer sums don't depend on distribution of runs between threads
+    result.Deadlocks += a.Deadlocks;
+    result.Steps += a.Steps;
+    markings += a.Markings;
+    for (size_t e = 0; e < a.Firings.size(); e++) {
+      result.Firings[e] += a.Firings[e];
+    }
+    for (size_t s = 0; s < a.TokenSums.size(); s++) {
+      token_sums[s] += a.TokenSums[s];
+    }
+  }
+  if (result.Runs) {
+    result.DeadlockRate = static_cast<double>(result.Deadlocks) / static_cast<double>(result.Runs);
+  }
+  result.FiringFrequencies.resize(result.Firings.size(), 0.0);
+  if (result.Steps) {
+    for (size_t e = 0; e < result.Firings.size(); e++) {
+      result.FiringFrequencies[e] = static_cast<double>(result.Firings[e]) / static_cast<double>(result.Steps);
+    }
+  }
+  result.MeanTokens.resize(token_sums.size(), 0.0);
+  if (markings) {
+    for (size_t s = 0; s < token_sums.size(); s++) {
+      result.MeanTokens[s] = static_cast<double>(token_sums[s]) / static_cast<double>(markings);
+    }
+  }
+  if (result.Seconds > 0.0) {
+    result.FiringsPerSecond = static_cast<double>(result.Steps) / result.Seconds;
+  }
+  return result;
+}
@@ -0,0 +1,312 @@
+/*! @file net_binary.cpp
+Binary format of Petri nets and @ref des::MappedNet class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "automation_builder.hpp"
+#include "net_binary.hpp"
+
+
+using namespace std;
+using namespace des;
+
+static_assert(sizeof(BinaryNetHeader) == 128, "binary net header must have fixed size");
+static_assert(sizeof(Arc) == 2 * sizeof(uint32_t) && sizeof(unsigned) == sizeof(uint32_t),
+  "links of compiled net must have layout of binary net");
+
+namespace {
+
+  // Alignment of sections.
+  const size_t section_alignment = 8;
+
+  // Image of binary net built in memory before writing.
+  class Image {
+  public:
+    // appends array as a new aligned section and returns its offset
+    template<typename T>
+    uint64_t append(const T* d, size_t n) {
+      _data.resize((_data.size() + section_alignment - 1) / section_alignment * section_alignment, 0);
+      const uint64_t offset = _data.size();
+      if (n) {
+        _data.insert(_data.end(), reinterpret_cast<const char*>(d), reinterpret_cast<const char*>(d + n));
+      }
+      return offset;
+    }
+    vector<char>& data() noexcept {
+      return _data;
+    }
+  private:
+    vector<char> _data;
+  };
+
+  // Checks quantity for 32-bit field.
+  uint32_t narrow(size_t n, const char* what) {
+    if (n > numeric_limits<uint32_t>::max()) {
+      throw length_error(string("writeBinaryNet: quantity of ") + what + " exceeds 32-bit numbers");
+    }
+    return static_cast<uint32_t>(n);
+  }
+
+} // namespace
+
+// Writing into stream.
+void des::writeBinaryNet(ostream& o, const Automation& a) {
+  const CompiledNet n(a);
+  BinaryNetHeader h;
+  h.HeaderSize = sizeof(BinaryNetHeader);
+  h.States = narrow(n.getStateQuantity(), "states");
+  h.Events = narrow(n.getEventQuantity(), "events");
+
+  string strings;
+  auto addString = [&](const string& s) {
+    const BinaryString r = { narrow(strings.size(), "name characters"), narrow(s.size(), "name characters") };
+    strings += s;
+    return r;
+  };
+  vector<BinaryState> states(h.States);
+  for (size_t i = 0; i < h.States; i++) {
+    states[i].Name = addString(n.getStateName(i));
+    states[i].Tokens = n.getInitialMarking()[i];
+  }
+  vector<BinaryEvent> events(h.Events);
+  vector<uint32_t> input_offsets(1, 0), output_offsets(1, 0), masked_offsets(1, 0);
+  vector<Arc> inputs, outputs;
+  vector<BinaryString> masked;
+  for (size_t t = 0; t < h.Events; t++) {
+    events[t].Name = addString(n.getEventName(t));
+    events[t].Type = static_cast<uint32_t>(n.getType(t));
+    inputs.insert(inputs.end(), n.getEventInputs(t).begin(), n.getEventInputs(t).end());
+    input_offsets.push_back(narrow(inputs.size(), "links"));
+    outputs.insert(outputs.end(), n.getEventOutputs(t).begin(), n.getEventOutputs(t).end());
+    output_offsets.push_back(narrow(outputs.size(), "links"));
+    if (n.getType(t) == EventType::macro) {
+      for (const auto& m : a.getEventCopy(n.getEventName(t)).getMaskedEvents()) {
+        masked.push_back(addString(m));
+      }
+    }
+    masked_offsets.push_back(narrow(masked.size(), "masked events"));
+  }
+  h.Inputs = narrow(inputs.size(), "links");
+  h.Outputs = narrow(outputs.size(), "links");
+  h.Masked = narrow(masked.size(), "masked events");
+
+  Image image;
+  image.append(&h, 1);
+  h.Strings = image.append(strings.data(), strings.size());
+  h.StringBytes = strings.size();
+  h.StateTable = image.append(states.data(), states.size());
+  h.EventTable = image.append(events.data(), events.size());
+  h.InputOffsets = image.append(input_offsets.data(), input_offsets.size());
+  h.InputArcs = image.append(inputs.data(), inputs.size());
+  h.OutputOffsets = image.append(output_offsets.data(), output_offsets.size());
+  h.OutputArcs = image.append(outputs.data(), outputs.size());
+  h.MaskedOffsets = image.append(masked_offsets.data(), masked_offsets.size());
+  h.MaskedNames = image.append(masked.data(), masked.size());
+  image.append<char>(nullptr, 0); // the file size is aligned too
+  h.FileSize = image.data().size();
+  memcpy(image.data().data(), &h, sizeof(h));
+  if (!o.write(image.data().data(), static_cast<streamsize>(image.data().size()))) {
+    throw runtime_error("writeBinaryNet: writing error");
+  }
+}
+
+// Writing into file.
+void des::writeBinaryNetFile(const string& p, const Automation& a) {
+  ofstream f(p, ios::binary | ios::trunc);
+  if (!f) {
+    throw runtime_error("writeBinaryNetFile: file can't be created " + p);
+  }
+  writeBinaryNet(f, a);
+  f.close();
+  if (!f) {
+    throw runtime_error("writeBinaryNetFile: file can't be written " + p);
+  }
+}
+
+// Constructor of des::MappedNet object for file.
+MappedNet::MappedNet(const string& p) {
+#if defined(_WIN32)
+  ifstream f(p, ios::binary | ios::ate);
+  if (!f) {
+    throw runtime_error("MappedNet: file can't be opened " + p);
+  }
+  const size_t size = static_cast<size_t>(f.tellg());
+  _buffer.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+  f.seekg(0);
+  if (!f.read(reinterpret_cast<char*>(_buffer.data()), static_cast<streamsize>(size))) {
+    throw runtime_error("MappedNet: file can't be read " + p);
+  }
+  _data = reinterpret_cast<const char*>(_buffer.data());
+#else
+  const int fd = open(p.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw runtime_error("MappedNet: file can't be opened " + p);
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(BinaryNetHeader))) {
+    close(fd);
+    throw runtime_error("MappedNet: file isn't a binary net " + p);
+  }
+  const size_t size = static_cast<size_t>(st.st_size);
+  void* m = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (m == MAP_FAILED) {
+    throw runtime_error("MappedNet: file can't be mapped " + p);
+  }
+  _data = static_cast<const char*>(m);
+  _mapped_size = size;
+#endif
+  try {
+    attach(size);
+  }
+  catch (...) {
+#if !defined(_WIN32)
+    munmap(const_cast<char*>(_data), _mapped_size);
+#endif
+    throw;
+  }
+}
+
+// Constructor of des::MappedNet object for data in memory.
+MappedNet::MappedNet(const void* d, size_t s) : _data(static_cast<const char*>(d)) {
+  attach(s);
+}
+
+// Destructor of des::MappedNet object.
+MappedNet::~MappedNet() {
+#if !defined(_WIN32)
+  if (_mapped_size) {
+    munmap(const_cast<char*>(_data), _mapped_size);
+  }
+#endif
+}
+
+// Check of the header and references.
+void MappedNet::attach(size_t s) {
+  auto fail = [](const string& m) {
+    throw runtime_error("MappedNet: " + m);
+  };
+  if (s < sizeof(BinaryNetHeader) || reinterpret_cast<uintptr_t>(_data) % section_alignment) {
+    fail("data isn't a binary net");
+  }
+  _header = reinterpret_cast<const BinaryNetHeader*>(_data);
+  const BinaryNetHeader& h = *_header;
+  if (memcmp(h.Magic, BinaryNetHeader().Magic, sizeof(h.Magic)) != 0) {
+    fail("data isn't a binary net");
+  }
+  if (h.ByteOrder != BinaryNetHeader().ByteOrder) {
+    fail("byte order of binary net isn't supported");
+  }
+  if (h.Version != binary_net_version || h.HeaderSize != sizeof(BinaryNetHeader)) {
+    fail("version " + to_string(h.Version) + " of binary net isn't supported");
+  }
+  if (h.FileSize != s) {
+    fail("binary net is truncated");
+  }
+  // returns pointer to section after check of its bounds
+  auto section = [&](uint64_t offset, uint64_t count, size_t size) {
+    if (offset % section_alignment || offset > s || count > (s - offset) / size) {
+      fail("section is out of data");
+    }
+    return _data + offset;
+  };
+  _strings = section(h.Strings, h.StringBytes, 1);
+  _states = reinterpret_cast<const BinaryState*>(section(h.StateTable, h.States, sizeof(BinaryState)));
+  _events = reinterpret_cast<const BinaryEvent*>(section(h.EventTable, h.Events, sizeof(BinaryEvent)));
+  _input_offsets = reinterpret_cast<const uint32_t*>(section(h.InputOffsets, h.Events + 1ull, sizeof(uint32_t)));
+  _inputs = reinterpret_cast<const Arc*>(section(h.InputArcs, h.Inputs, sizeof(Arc)));
+  _output_offsets = reinterpret_cast<const uint32_t*>(section(h.OutputOffsets, h.Events + 1ull, sizeof(uint32_t)));
+  _outputs = reinterpret_cast<const Arc*>(section(h.OutputArcs, h.Outputs, sizeof(Arc)));
+  _masked_offsets = reinterpret_cast<const uint32_t*>(section(h.MaskedOffsets, h.Events + 1ull, sizeof(uint32_t)));
+  _masked = reinterpret_cast<const BinaryString*>(section(h.MaskedNames, h.Masked, sizeof(BinaryString)));
+
+  auto checkString = [&](const BinaryString& r) {
+    if (r.Offset > h.StringBytes || r.Length > h.StringBytes - r.Offset) {
+      fail("name is out of string table");
+    }
+  };
+  auto checkOffsets = [&](const uint32_t* o, uint32_t last) {
+    if (o[0] != 0 || o[h.Events] != last) {
+      fail("invalid link offsets");
+    }
+    for (size_t t = 0; t < h.Events; t++) {
+      if (o[t] > o[t + 1]) {
+        fail("invalid link offsets");
+      }
+    }
+  };
+  for (size_t i = 0; i < h.States; i++) {
+    checkString(_states[i].Name);
+    if (i && getStateName(i - 1) >= getStateName(i)) {
+      fail("state names aren't sorted or unique");
+    }
+  }
+  for (size_t i = 0; i < h.Events; i++) {
+    checkString(_events[i].Name);
+    if (i && getEventName(i - 1) >= getEventName(i)) {
+      fail("event names aren't sorted or unique");
+    }
+    if (_events[i].Type > static_cast<uint32_t>(EventType::macro)) {
+      fail("invalid event type");
+    }
+  }
+  checkOffsets(_input_offsets, h.Inputs);
+  checkOffsets(_output_offsets, h.Outputs);
+  checkOffsets(_masked_offsets, h.Masked);
+  for (size_t t = 0; t < h.Events; t++) {
+    for (const auto& r : { getEventInputs(t), getEventOutputs(t) }) {
+      for (const Arc* a = r.First; a != r.Last; a++) {
+        if (a->Index >= h.States) {
+          fail("link refers to absent state");
+        }
+        if (!a->Multiplicity) {
+          fail("link has zero multiplicity");
+        }
+        if (a != r.First && a[-1].Index >= a->Index) {
+          fail("links of event aren't sorted or unique");
+        }
+      }
+    }
+  }
+  for (size_t i = 0; i < h.Masked; i++) {
+    checkString(_masked[i]);
+  }
+}
+
+// Conversion into des::Automation object.
+Automation MappedNet::toAutomation() const {
+  // names are sorted, so the builder doesn't sort them
+  AutomationBuilder builder;
+  builder.reserve(getStateQuantity(), getEventQuantity(), _header->Inputs + _header->Outputs);
+  for (size_t i = 0; i < getStateQuantity(); i++) {
+    builder.addState(std::string(getStateName(i)), getActivity(i));
+  }
+  for (size_t t = 0; t < getEventQuantity(); t++) {
+    Event e(getType(t));
+    if (getType(t) == EventType::macro) {
+      for (size_t k = 0; k < getMaskedEventQuantity(t); k++) {
+        e.addMaskedEvent(std::string(getMaskedEvent(t, k)));
+      }
+    }
+    builder.addEvent(std::string(getEventName(t)), std::move(e));
+    for (const auto& a : getEventInputs(t)) {
+      builder.addLinkFromStateToEvent(a.Index, t, a.Multiplicity);
+    }
+    for (const auto& a : getEventOutputs(t)) {
+      builder.addLinkFromEventToState(t, a.Index, a.Multiplicity);
+    }
+  }
+  return builder.build();
+}
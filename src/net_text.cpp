@@ -0,0 +1,115 @@
+/*! @file net_text.cpp
+Text format of Petri nets source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "net_text.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Names of event types in text description.
+  const char* event_type_names[] = { "controllable", "uncontrollable", "expected" };
+
+  // Parses unsigned number, all characters of the word must be digits.
+  unsigned parseNumber(const string& w, size_t line) {
+    if (w.empty() || w.find_first_not_of("0123456789") != string::npos || w.size() > 10 ||
+      stoull(w) > numeric_limits<unsigned>::max()) {
+      throw runtime_error("readNet: line " + to_string(line) + ": invalid number " + w);
+    }
+    return static_cast<unsigned>(stoull(w));
+  }
+
+} // namespace
+
+// Reading from stream.
+Automation des::readNet(istream& i) {
+  Automation result;
+  string text;
+  for (size_t line = 1; getline(i, text); line++) {
+    const size_t comment = text.find('#');
+    if (comment != string::npos) {
+      text.resize(comment);
+    }
+    istringstream s(text);
+    vector<string> words;
+    for (string w; s >> w;) {
+      words.push_back(w);
+    }
+    if (words.empty()) {
+      continue;
+    }
+    const string& kind = words[0];
+    if (kind == "state" && (words.size() == 2 || words.size() == 3)) {
+      result.addState(words[1], words.size() == 3 ? parseNumber(words[2], line) : 0);
+    }
+    else if (kind == "event" && (words.size() == 2 || words.size() == 3)) {
+      size_t type = 0;
+      if (words.size() == 3) {
+        while (type < size(event_type_names) && words[2] != event_type_names[type]) {
+          type++;
+        }
+        if (type == size(event_type_names)) {
+          throw runtime_error("readNet: line " + to_string(line) + ": invalid event type " + words[2]);
+        }
+      }
+      result.addEvent(words[1], static_cast<EventType>(type));
+    }
+    else if (kind == "arc" && (words.size() == 3 || words.size() == 4)) {
+      const unsigned m = words.size() == 4 ? parseNumber(words[3], line) : 1;
+      if (result.checkState(words[1]) && result.checkEvent(words[2])) {
+        result.setLinkFromStateToEvent(words[1], words[2], m);
+      }
+      else if (result.checkEvent(words[1]) && result.checkState(words[2])) {
+        result.setLinkFromEventToState(words[1], words[2], m);
+      }
+      else {
+        throw runtime_error("readNet: line " + to_string(line) + ": arc must link declared state and event");
+      }
+    }
+    else {
+      throw runtime_error("readNet: line " + to_string(line) + ": invalid record " + kind);
+    }
+  }
+  return result;
+}
+
+// Reading from file.
+Automation des::readNetFile(const string& p) {
+  ifstream f(p);
+  if (!f) {
+    throw runtime_error("readNetFile: file can't be opened " + p);
+  }
+  return readNet(f);
+}
+
+// Writing into stream.
+ostream& des::writeNet(ostream& o, const Automation& a) {
+  for (const auto& s : a.getStateNameSet()) {
+    o << "state " << s << ' ' << a.getActivity(s) << '\n';
+  }
+  const auto events = a.getEventNameSet();
+  for (const auto& e : events) {
+    const auto type = static_cast<size_t>(a.getEventCopy(e).type());
+    o << "event " << e << ' ' << (type < size(event_type_names) ? event_type_names[type] : "controllable") << '\n';
+  }
+  for (const auto& e : events) {
+    for (const auto& s : a.getEventInputs(e)) {
+      o << "arc " << s << ' ' << e << ' ' << a.getLinksFromStateToEvent(s, e) << '\n';
+    }
+    for (const auto& s : a.getEventOutputs(e)) {
+      o << "arc " << e << ' ' << s << ' ' << a.getLinksFromEventToState(e, s) << '\n';
+    }
+  }
+  return o;
+}
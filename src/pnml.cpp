@@ -0,0 +1,574 @@
+/*! @file pnml.cpp
+PNML importer source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "automation_builder.hpp"
+#include "pnml.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Size of the read buffer.
+  const size_t chunk_size = 1 << 16;
+
+  // Streaming pull parser of XML tokens.
+  class XmlReader {
+  public:
+
+    enum class Token { start, end, text, eof };
+
+    explicit XmlReader(istream& i) : _input(i), _buffer(chunk_size) {}
+
+    // Reads the next token, text is kept only if requested.
+    Token next(bool keep_text) {
+      if (_pending_end) {
+        _pending_end = false;
+        return Token::end;
+      }
+      _text.clear();
+      int c = peek();
+      if (c == eof) {
+        return Token::eof;
+      }
+      if (c != '<') {
+        readText(keep_text);
+        return Token::text;
+      }
+      get();
+      c = get();
+      if (c == '?') {
+        skipPast("?>");
+        return next(keep_text);
+      }
+      if (c == '!') {
+        if (peek() == '-') {
+          expect("--");
+          skipPast("-->");
+          return next(keep_text);
+        }
+        if (peek() == '[') {
+          expect("[CDATA[");
+          readCdata(keep_text);
+          return Token::text;
+        }
+        skipDeclaration();
+        return next(keep_text);
+      }
+      if (c == '/') {
+        readName();
+        skipSpaces();
+        if (get() != '>') {
+          fail("'>' expected");
+        }
+        return Token::end;
+      }
+      _name.clear();
+      _name += static_cast<char>(c);
+      readName(true);
+      readAttributes();
+      return Token::start;
+    }
+
+    // Local name of the element without namespace prefix.
+    const string& name() const noexcept {
+      return _name;
+    }
+
+    // Value of attribute of the started element or null pointer.
+    const string* attribute(const char* n) const noexcept {
+      for (size_t i = 0; i < _attribute_count; i++) {
+        if (_attributes[i].first == n) {
+          return &_attributes[i].second;
+        }
+      }
+      return nullptr;
+    }
+
+    const string& text() const noexcept {
+      return _text;
+    }
+
+    size_t line() const noexcept {
+      return _line;
+    }
+
+    size_t bytes() const noexcept {
+      return _consumed + _position;
+    }
+
+    [[noreturn]] void fail(const string& m) const {
+      throw runtime_error("readPnml: line " + to_string(_line) + ": " + m);
+    }
+
+  private:
+
+    static const int eof = -1;
+
+    int peek() {
+      if (_position == _size && !refill()) {
+        return eof;
+      }
+      return static_cast<unsigned char>(_buffer[_position]);
+    }
+
+    int get() {
+      const int c = peek();
+      if (c != eof) {
+        _position++;
+        if (c == '\n') {
+          _line++;
+        }
+      }
+      return c;
+    }
+
+    // Moves over characters until the stop predicate, appends them to the string, if it isn't null.
+    template<typename Stop>
+    void scan(string* r, Stop stop) {
+      for (;;) {
+        if (_position == _size && !refill()) {
+          return;
+        }
+        const char* first = _buffer.data() + _position;
+        const char* last = _buffer.data() + _size;
+        const char* p = first;
+        while (p != last && !stop(static_cast<unsigned char>(*p))) {
+          p++;
+        }
+        _line += static_cast<size_t>(count(first, p, '\n'));
+        if (r) {
+          r->append(first, p);
+        }
+        _position += static_cast<size_t>(p - first);
+        if (p != last) {
+          return;
+        }
+      }
+    }
+
+    bool refill() {
+      _consumed += _size;
+      _input.read(_buffer.data(), static_cast<streamsize>(_buffer.size()));
+      _size = static_cast<size_t>(_input.gcount());
+      _position = 0;
+      return _size != 0;
+    }
+
+    int getOrFail() {
+      const int c = get();
+      if (c == eof) {
+        fail("unexpected end of document");
+      }
+      return c;
+    }
+
+    void expect(const char* s) {
+      for (; *s; s++) {
+        if (getOrFail() != *s) {
+          fail(string("'") + s + "' expected");
+        }
+      }
+    }
+
+    void skipSpaces() {
+      scan(nullptr, [](int c) { return c != ' ' && c != '\t' && c != '\r' && c != '\n'; });
+    }
+
+    void skipPast(const char* s) {
+      const string pattern(s);
+      string window; // the last read characters
+      while (window != pattern) {
+        window += static_cast<char>(getOrFail());
+        if (window.size() > pattern.size()) {
+          window.erase(0, 1);
+        }
+      }
+    }
+
+    void skipDeclaration() {
+      int depth = 0;
+      for (int c = getOrFail(); c != '>' || depth; c = getOrFail()) {
+        depth += c == '[' ? 1 : (c == ']' ? -1 : 0);
+      }
+    }
+
+    static bool isNameChar(int c) noexcept {
+      return c != eof && c != '>' && c != '/' && c != '=' && c != ' ' && c != '\t' && c != '\r' && c != '\n';
+    }
+
+    // Reads name and removes namespace prefix.
+    void readName(bool append = false) {
+      if (!append) {
+        _name.clear();
+      }
+      scan(&_name, [](int c) { return !isNameChar(c); });
+      const size_t colon = _name.find(':');
+      if (colon != string::npos) {
+        _name.erase(0, colon + 1);
+      }
+      if (_name.empty()) {
+        fail("name expected");
+      }
+    }
+
+    void readAttributes() {
+      _attribute_count = 0;
+      for (;;) {
+        skipSpaces();
+        const int c = peek();
+        if (c == '>') {
+          get();
+          return;
+        }
+        if (c == '/') {
+          get();
+          if (get() != '>') {
+            fail("'>' expected");
+          }
+          _pending_end = true;
+          return;
+        }
+        if (_attribute_count == _attributes.size()) {
+          _attributes.emplace_back();
+        }
+        auto& a = _attributes[_attribute_count++];
+        a.first.clear();
+        scan(&a.first, [](int c) { return !isNameChar(c); });
+        if (a.first.empty()) {
+          fail("attribute name expected");
+        }
+        skipSpaces();
+        if (get() != '=') {
+          fail("'=' expected");
+        }
+        skipSpaces();
+        const int quote = getOrFail();
+        if (quote != '"' && quote != '\'') {
+          fail("quoted attribute value expected");
+        }
+        a.second.clear();
+        for (int v = 0; v != quote;) {
+          scan(&a.second, [quote](int c) { return c == quote || c == '&'; });
+          v = getOrFail();
+          if (v == '&') {
+            readEntity(a.second);
+          }
+        }
+      }
+    }
+
+    void readText(bool keep) {
+      if (!keep) {
+        scan(nullptr, [](int c) { return c == '<'; });
+        return;
+      }
+      for (int c = peek(); c != eof && c != '<'; c = peek()) {
+        scan(&_text, [](int c) { return c == '<' || c == '&'; });
+        if (peek() == '&') {
+          get();
+          readEntity(_text);
+        }
+      }
+    }
+
+    void readCdata(bool keep) {
+      size_t brackets = 0;
+      for (;;) {
+        const int c = getOrFail();
+        if (c == '>' && brackets >= 2) {
+          if (keep) {
+            _text.append(brackets - 2, ']');
+          }
+          return;
+        }
+        if (c == ']') {
+          brackets++;
+          continue;
+        }
+        if (keep) {
+          _text.append(brackets, ']');
+          _text += static_cast<char>(c);
+        }
+        brackets = 0;
+      }
+    }
+
+    // Decodes entity after '&' character.
+    void readEntity(string& r) {
+      string e;
+      for (int c = getOrFail(); c != ';'; c = getOrFail()) {
+        if (e.size() > 8) {
+          fail("invalid entity");
+        }
+        e += static_cast<char>(c);
+      }
+      if (e == "lt") { r += '<'; }
+      else if (e == "gt") { r += '>'; }
+      else if (e == "amp") { r += '&'; }
+      else if (e == "quot") { r += '"'; }
+      else if (e == "apos") { r += '\''; }
+      else if (e.size() > 1 && e[0] == '#') {
+        const bool hex = e[1] == 'x';
+        const string digits = e.substr(hex ? 2 : 1);
+        if (digits.empty() || digits.find_first_not_of(hex ? "0123456789abcdefABCDEF" : "0123456789") != string::npos) {
+          fail("invalid entity &" + e + ";");
+        }
+        const unsigned long code = stoul(digits, nullptr, hex ? 16 : 10);
+        r += code < 0x80 ? static_cast<char>(code) : '_'; // non-ASCII characters aren't allowed in names anyway
+      }
+      else {
+        fail("unknown entity &" + e + ";");
+      }
+    }
+
+    istream& _input;
+    vector<char> _buffer;
+    size_t _size = 0;
+    size_t _position = 0;
+    size_t _consumed = 0;
+    size_t _line = 1;
+    bool _pending_end = false;
+    string _name;
+    string _text;
+    vector<pair<string, string>> _attributes;
+    size_t _attribute_count = 0;
+  };
+
+  // Node of the net.
+  struct PnmlNode {
+    string Id;
+    bool Place = true;
+    unsigned Tokens = 0;
+  };
+
+  // Arc of the net.
+  struct PnmlArc {
+    string Source;
+    string Target;
+    unsigned Weight = 1;
+    size_t Line = 0;
+  };
+
+  // Name allowed by des::checkNameString.
+  string sanitize(const string& id, unordered_set<string>& used) {
+    string result;
+    for (const char c : id) {
+      const bool allowed = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' ||
+        c == '/';
+      result += allowed ? c : '_';
+    }
+    if (result.empty() || !((result[0] >= 'a' && result[0] <= 'z') || (result[0] >= 'A' && result[0] <= 'Z'))) {
+      result = "n_" + result;
+    }
+    const size_t max_base = max_name_length - 1 - 12; // room for numeric suffix
+    if (result.size() > max_base) {
+      result.resize(max_base);
+    }
+    if (!used.insert(result).second) {
+      for (size_t k = 2;; k++) {
+        const string candidate = result + "_" + to_string(k);
+        if (used.insert(candidate).second) {
+          result = candidate;
+          break;
+        }
+      }
+    }
+    return result;
+  }
+
+  unsigned parseCount(const XmlReader& r, const string& s) {
+    const size_t first = s.find_first_not_of(" \t\r\n");
+    const size_t last = s.find_last_not_of(" \t\r\n");
+    if (first == string::npos) {
+      r.fail("number expected");
+    }
+    const string digits = s.substr(first, last - first + 1);
+    if (digits.find_first_not_of("0123456789") != string::npos || digits.size() > 10 ||
+      stoull(digits) > numeric_limits<unsigned>::max()) {
+      r.fail("invalid number " + digits);
+    }
+    return static_cast<unsigned>(stoull(digits));
+  }
+
+} // namespace
+
+// Reading from stream.
+Automation des::readPnml(istream& i, PnmlStatistics* s) {
+  const auto started = chrono::steady_clock::now();
+  XmlReader r(i);
+  vector<PnmlNode> nodes;
+  unordered_map<string, size_t> node_indexes;
+  unordered_map<string, string> references;
+  vector<PnmlArc> arcs;
+
+  vector<string> stack; // names of open elements
+  enum class Owner { none, place, transition, arc } owner = Owner::none;
+  size_t owner_depth = 0;
+  PnmlNode node;
+  PnmlArc arc;
+  bool root = false;
+  for (auto t = XmlReader::Token::start; t != XmlReader::Token::eof;) {
+    // text is kept only for values of initial markings and inscriptions
+    const size_t d = stack.size();
+    const bool value = owner != Owner::none && d == owner_depth + 2 && (stack[d - 1] == "text" ||
+      stack[d - 1] == "value") && (stack[d - 2] == "initialMarking" || stack[d - 2] == "inscription");
+    t = r.next(value);
+    if (t == XmlReader::Token::start) {
+      const string& n = r.name();
+      if (!root) {
+        if (n != "pnml") {
+          r.fail("pnml element expected");
+        }
+        root = true;
+      }
+      stack.push_back(n);
+      if (owner != Owner::none) {
+        continue;
+      }
+      const string* id = r.attribute("id");
+      if (n == "place" || n == "transition" || n == "arc") {
+        if (!id) {
+          r.fail(n + " without id");
+        }
+        owner = n == "place" ? Owner::place : (n == "transition" ? Owner::transition : Owner::arc);
+        owner_depth = stack.size();
+        if (owner == Owner::arc) {
+          const string* source = r.attribute("source");
+          const string* target = r.attribute("target");
+          if (!source || !target) {
+            r.fail("arc without source or target");
+          }
+          arc = { *source, *target, 1, r.line() };
+        }
+        else {
+          node = { *id, owner == Owner::place, 0 };
+        }
+      }
+      else if (n == "referencePlace" || n == "referenceTransition") {
+        const string* ref = r.attribute("ref");
+        if (!id || !ref) {
+          r.fail(n + " without id or ref");
+        }
+        references[*id] = *ref;
+      }
+    }
+    else if (t == XmlReader::Token::text && value) {
+      const unsigned v = parseCount(r, r.text());
+      if (stack[d - 2] == "initialMarking" && owner == Owner::place) {
+        node.Tokens = v;
+      }
+      else if (stack[d - 2] == "inscription" && owner == Owner::arc) {
+        arc.Weight = v;
+      }
+    }
+    else if (t == XmlReader::Token::end) {
+      if (stack.empty()) {
+        r.fail("unexpected closing tag");
+      }
+      if (owner != Owner::none && stack.size() == owner_depth) {
+        if (owner == Owner::arc) {
+          arcs.push_back(std::move(arc));
+        }
+        else {
+          if (!node_indexes.emplace(node.Id, nodes.size()).second) {
+            r.fail("duplicate id " + node.Id);
+          }
+          nodes.push_back(std::move(node));
+        }
+        owner = Owner::none;
+      }
+      stack.pop_back();
+    }
+  }
+  if (!root || !stack.empty()) {
+    r.fail("unexpected end of document");
+  }
+
+  // names of states and events
+  AutomationBuilder builder;
+  const size_t places = static_cast<size_t>(count_if(nodes.begin(), nodes.end(),
+    [](const PnmlNode& n) { return n.Place; }));
+  builder.reserve(places, nodes.size() - places, arcs.size());
+  unordered_set<string> used;
+  vector<size_t> indexes(nodes.size()); // indexes of nodes in the builder
+  for (size_t k = 0; k < nodes.size(); k++) {
+    const auto& n = nodes[k];
+    indexes[k] = n.Place ? builder.addState(sanitize(n.Id, used), n.Tokens) : builder.addEvent(sanitize(n.Id, used));
+  }
+  used.clear();
+
+  // arcs between resolved nodes
+  auto resolve = [&](const string& id, size_t line) {
+    const string* current = &id;
+    for (size_t k = 0; k <= references.size(); k++) {
+      const auto n = node_indexes.find(*current);
+      if (n != node_indexes.end()) {
+        return n->second;
+      }
+      const auto ref = references.find(*current);
+      if (ref == references.end()) {
+        break;
+      }
+      current = &ref->second;
+    }
+    throw runtime_error("readPnml: line " + to_string(line) + ": arc refers to absent node " + id);
+  };
+  for (const auto& a : arcs) {
+    const size_t source = resolve(a.Source, a.Line), target = resolve(a.Target, a.Line);
+    if (nodes[source].Place == nodes[target].Place) {
+      throw runtime_error("readPnml: line " + to_string(a.Line) + ": arc must link place and transition");
+    }
+    if (nodes[source].Place) {
+      builder.addLinkFromStateToEvent(indexes[source], indexes[target], a.Weight);
+    }
+    else {
+      builder.addLinkFromEventToState(indexes[source], indexes[target], a.Weight);
+    }
+  }
+  arcs.clear();
+  arcs.shrink_to_fit();
+
+  // names are unique and valid, only sums of parallel arcs can fail
+  auto build = [&builder]() {
+    try {
+      return builder.build();
+    }
+    catch (const invalid_argument& e) {
+      throw runtime_error(string("readPnml: ") + e.what());
+    }
+  };
+  const Automation result = build();
+
+  if (s) {
+    s->Bytes = r.bytes();
+    s->Places = places;
+    s->Transitions = nodes.size() - places;
+    s->Arcs = 0;
+    for (const auto& n : result.getEventNameSet()) {
+      s->Arcs += result.getEventInputLinksQuantity(n) + result.getEventOutputLinksQuantity(n);
+    }
+    s->Duration = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - started);
+  }
+  return result;
+}
+
+// Reading from file.
+Automation des::readPnmlFile(const string& p, PnmlStatistics* s) {
+  ifstream f(p, ios::binary);
+  if (!f) {
+    throw runtime_error("readPnmlFile: file can't be opened " + p);
+  }
+  return readPnml(f, s);
+}
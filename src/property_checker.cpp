@@ -0,0 +1,214 @@
+/*! @file property_checker.cpp
+@ref des::PropertyChecker class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <chrono>
+#include <stdexcept>
+
+#include "marking_store.hpp"
+#include "property_checker.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Quantity of expanded markings between clock checks.
+  const size_t clock_check_period = 64;
+
+  // Witness of marking by number.
+  Witness makeWitness(const CompiledNet& n, const MarkingStore& s, size_t i) {
+    Witness result;
+    for (const auto& e : s.getPath(i)) {
+      result.Events.push_back(n.getEventName(e));
+    }
+    const unsigned* m = s.data(i);
+    for (size_t p = 0; p < n.getStateQuantity(); p++) {
+      result.Marking.emplace_hint(result.Marking.end(), n.getStateName(p), m[p]);
+    }
+    return result;
+  }
+
+} // namespace
+
+// Constructor of des::PropertyChecker object.
+PropertyChecker::PropertyChecker(const CompiledNet& n) : _net(n), _properties() {
+}
+
+// Deadlock freedom property addition.
+size_t PropertyChecker::addDeadlockFreedom(const string& n) {
+  _properties.push_back({ n, PropertyKind::deadlockFreedom, {}, 0, nullptr });
+  return _properties.size() - 1;
+}
+
+// Bound property addition.
+size_t PropertyChecker::addBound(const set<string>& s, unsigned k, const string& n) {
+  vector<size_t> states;
+  if (s.empty()) {
+    for (size_t i = 0; i < _net.getStateQuantity(); i++) {
+      states.push_back(i);
+    }
+  }
+  for (const auto& i : s) {
+    try {
+      states.push_back(_net.getStateIndex(i));
+    }
+    catch (const out_of_range&) {
+      throw invalid_argument("addBound: the net hasn't state " + i);
+    }
+  }
+  _properties.push_back({ n, PropertyKind::bound, states, k, nullptr });
+  return _properties.size() - 1;
+}
+
+// Target property addition.
+size_t PropertyChecker::addTarget(const MarkingPredicate& p, const string& n) {
+  if (!p) {
+    throw invalid_argument("addTarget: predicate is empty");
+  }
+  _properties.push_back({ n, PropertyKind::target, {}, 0, p });
+  return _properties.size() - 1;
+}
+
+// Exploration until all properties are decided.
+PropertyCheckResult PropertyChecker::run(const AnalysisOptions& o) const {
+  if (_properties.empty()) {
+    throw logic_error("run: the checker has no properties");
+  }
+  PropertyCheckResult result;
+  for (const auto& p : _properties) {
+    result.Properties.push_back({ p.Name, p.Kind, Verdict::unknown, nullopt, 0 });
+  }
+  size_t undecided = _properties.size();
+  bool deadlock_checked = false; // there is an undecided deadlock freedom property
+  for (const auto& p : _properties) {
+    deadlock_checked |= p.Kind == PropertyKind::deadlockFreedom;
+  }
+
+  MarkingStore store(_net.getStateQuantity());
+  // decides bound and target properties on the discovered marking
+  auto discover = [&](size_t i, const Marking& m) {
+    for (size_t k = 0; k < _properties.size(); k++) {
+      auto& v = result.Properties[k];
+      if (v.Value != Verdict::unknown) {
+        continue;
+      }
+      const auto& p = _properties[k];
+      bool decided = false;
+      if (p.Kind == PropertyKind::bound) {
+        for (const auto& s : p.States) {
+          if (m[s] > p.Bound) {
+            decided = true;
+            break;
+          }
+        }
+        if (decided) {
+          v.Value = Verdict::no;
+        }
+      }
+      else if (p.Kind == PropertyKind::target && p.Predicate(m)) {
+        decided = true;
+        v.Value = Verdict::yes;
+      }
+      if (decided) {
+        v.Trace = makeWitness(_net, store, i);
+        v.States = store.size();
+        undecided--;
+      }
+    }
+  };
+
+  const auto started = chrono::steady_clock::now();
+  auto next_report = started + o.ProgressInterval;
+  // reports progress, if the interval is over
+  auto report = [&](size_t i, chrono::steady_clock::time_point now) {
+    AnalysisProgress p;
+    p.States = store.size();
+    p.Frontier = store.size() - i;
+    p.Memory = store.memory();
+    p.Depth = i < store.size() ? store.getPath(i).size() : 0;
+    p.Elapsed = chrono::duration_cast<chrono::milliseconds>(now - started);
+    const double seconds = chrono::duration<double>(now - started).count();
+    if (seconds > 0) {
+      p.StatesPerSecond = static_cast<double>(store.size()) / seconds;
+    }
+    o.Progress(p);
+    next_report = now + o.ProgressInterval;
+  };
+
+  Marking current = _net.getInitialMarking(), next(current.size());
+  store.insert(current);
+  discover(0, current);
+  size_t i = 0; // markings with smaller numbers are expanded, the other ones form the queue
+  for (; i < store.size() && undecided; i++) {
+    if (o.Cancellation && o.Cancellation->isCancelled()) {
+      result.Status = AnalysisStatus::cancelled;
+    }
+    else if (o.MaxStates && store.size() >= o.MaxStates) {
+      result.Status = AnalysisStatus::stateLimit;
+    }
+    else if (o.MaxMemory && store.memory() > o.MaxMemory) {
+      result.Status = AnalysisStatus::memoryLimit;
+    }
+    else if ((o.TimeLimit.count() || o.Progress) && i % clock_check_period == 0) {
+      const auto now = chrono::steady_clock::now();
+      if (o.TimeLimit.count() && now - started > o.TimeLimit) {
+        result.Status = AnalysisStatus::timeLimit;
+      }
+      else if (o.Progress && now >= next_report) {
+        report(i, now);
+      }
+    }
+    if (result.Status != AnalysisStatus::complete) {
+      break;
+    }
+    store.get(i, current);
+    bool terminal = true;
+    for (size_t t = 0; t < _net.getEventQuantity() && undecided; t++) {
+      if (!_net.isReady(current, t)) {
+        continue;
+      }
+      terminal = false;
+      _net.fire(current, t, next);
+      const auto added = store.insert(next, i, t);
+      if (added.second) {
+        discover(added.first, next);
+      }
+    }
+    if (terminal) {
+      result.Statistics.TerminalStates++;
+      for (size_t k = 0; deadlock_checked && k < _properties.size(); k++) {
+        auto& v = result.Properties[k];
+        if (_properties[k].Kind == PropertyKind::deadlockFreedom && v.Value == Verdict::unknown) {
+          v.Value = Verdict::no;
+          v.Trace = makeWitness(_net, store, i);
+          v.States = store.size();
+          undecided--;
+        }
+      }
+      deadlock_checked = false;
+    }
+  }
+  if (result.Status == AnalysisStatus::complete && undecided) {
+    // the reachability set is explored exhaustively: violations and targets are absent
+    for (auto& v : result.Properties) {
+      if (v.Value == Verdict::unknown) {
+        v.Value = v.Kind == PropertyKind::target ? Verdict::no : Verdict::yes;
+        v.States = store.size();
+      }
+    }
+  }
+
+  const auto finished = chrono::steady_clock::now();
+  result.Statistics.States = store.size();
+  result.Statistics.Frontier = store.size() - i;
+  result.Statistics.Memory = store.memory();
+  result.Statistics.PeakMemory = result.Statistics.Memory; // the store only grows
+  result.Statistics.Duration = chrono::duration_cast<chrono::milliseconds>(finished - started);
+  if (o.Progress) {
+    report(i, finished);
+  }
+  return result;
+}
@@ -0,0 +1,460 @@
+/*! @file result_cache.cpp
+@ref des::ResultCache class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "result_cache.hpp"
+#include "splitmix.hpp"
+
+
+using namespace std;
+using namespace des;
+namespace fs = std::filesystem;
+
+namespace {
+
+  // Header of the index file, it's followed by entries.
+  struct IndexHeader {
+    char Magic[4] = { 'D', 'E', 'S', 'C' };
+    uint32_t Version = 1;
+    uint32_t ByteOrder = 0x01020304;
+    uint32_t Entries = 0;
+    uint64_t Clock = 0;  // counter of uses
+    uint64_t Bytes = 0;  // total size of values
+  };
+
+  // Entry of the index, zero size marks a free entry.
+  struct IndexEntry {
+    uint64_t High = 0;
+    uint64_t Low = 0;
+    uint64_t Bytes = 0;
+    uint64_t LastUse = 0;
+  };
+
+  static_assert(sizeof(IndexHeader) == 32 && sizeof(IndexEntry) == 32, "index of result cache must have fixed layout");
+
+  // Names of index and value files.
+  const char* index_name = "index";
+  const char* value_extension = ".result";
+
+  // Signature of value files.
+  const char value_magic[4] = { 'D', 'E', 'S', 'R' };
+  const uint32_t value_version = 1;
+
+  // Key of the cache by fingerprint and limits, which change deterministic results.
+  Fingerprint makeKey(const Fingerprint& f, const AnalysisOptions& o) noexcept {
+    return { mix64(f.High ^ mix64(o.MaxMemory)), mix64(f.Low ^ mix64(o.MaxStates ^ golden_gamma)) };
+  }
+
+  // Serialization of result into bytes of native order.
+  class Writer {
+  public:
+    void put(uint64_t v) {
+      _data.append(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+    void put(const string& s) {
+      put(s.size());
+      _data += s;
+    }
+    template<class C>
+    void putNames(const C& c) {
+      put(c.size());
+      for (const auto& s : c) {
+        put(s);
+      }
+    }
+    void put(const optional<Witness>& w) {
+      put(w ? 1 : 0);
+      if (w) {
+        putNames(w->Events);
+        put(w->Marking.size());
+        for (const auto& m : w->Marking) {
+          put(m.first);
+          put(m.second);
+        }
+      }
+    }
+    const string& data() const noexcept {
+      return _data;
+    }
+  private:
+    string _data;
+  };
+
+  // Deserialization of result, it throws std::runtime_error for damaged data.
+  class Reader {
+  public:
+    explicit Reader(const string& d) : _data(d) {}
+    uint64_t get() {
+      uint64_t v = 0;
+      take(&v, sizeof(v));
+      return v;
+    }
+    string getString() {
+      const uint64_t n = get();
+      if (n > _data.size() - _position) {
+        throw runtime_error("ResultCache: value is damaged");
+      }
+      string result = _data.substr(_position, n);
+      _position += n;
+      return result;
+    }
+    template<class T>
+    T getEnum(T last) {
+      const uint64_t v = get();
+      if (v > static_cast<uint64_t>(last)) {
+        throw runtime_error("ResultCache: value is damaged");
+      }
+      return static_cast<T>(v);
+    }
+    optional<Witness> getWitness() {
+      if (!get()) {
+        return nullopt;
+      }
+      Witness w;
+      for (uint64_t n = get(); n; n--) {
+        w.Events.push_back(getString());
+      }
+      for (uint64_t n = get(); n; n--) {
+        string s = getString();
+        w.Marking.emplace(std::move(s), static_cast<unsigned>(get()));
+      }
+      return w;
+    }
+    set<string> getNames() {
+      set<string> result;
+      for (uint64_t n = get(); n; n--) {
+        result.insert(result.end(), getString());
+      }
+      return result;
+    }
+    bool finished() const noexcept {
+      return _position == _data.size();
+    }
+    void take(void* d, size_t n) {
+      if (n > _data.size() - _position) {
+        throw runtime_error("ResultCache: value is damaged");
+      }
+      memcpy(d, _data.data() + _position, n);
+      _position += n;
+    }
+  private:
+    const string& _data;
+    size_t _position = 0;
+  };
+
+  string serialize(const Fingerprint& k, const AnalysisResult& r) {
+    Writer w;
+    uint64_t magic = 0;
+    memcpy(&magic, value_magic, sizeof(value_magic));
+    w.put(magic | static_cast<uint64_t>(value_version) << 32);
+    w.put(k.High);
+    w.put(k.Low);
+    w.put(static_cast<uint64_t>(r.Status));
+    for (const auto v : { r.Alive, r.Coherent, r.Safe, r.Reachable }) {
+      w.put(static_cast<uint64_t>(v));
+    }
+    w.put(r.Deadlock);
+    w.put(r.Unbounded);
+    w.putNames(r.DeadEvents);
+    w.putNames(r.Disconnected);
+    const auto& s = r.Statistics;
+    for (const uint64_t v : { s.States, s.Frontier, s.TerminalStates, s.OmegaNodes, s.Memory, s.PeakMemory }) {
+      w.put(v);
+    }
+    w.put(static_cast<uint64_t>(s.Duration.count()));
+    w.put(static_cast<uint64_t>(r.Timings.Exploration.count()));
+    w.put(static_cast<uint64_t>(r.Timings.Verdicts.count()));
+    w.put(static_cast<uint64_t>(r.Timings.Connectivity.count()));
+    return w.data();
+  }
+
+  AnalysisResult deserialize(const Fingerprint& k, const string& d) {
+    Reader r(d);
+    uint64_t magic = 0;
+    memcpy(&magic, value_magic, sizeof(value_magic));
+    if (r.get() != (magic | static_cast<uint64_t>(value_version) << 32) || r.get() != k.High || r.get() != k.Low) {
+      throw runtime_error("ResultCache: value has other key or version");
+    }
+    AnalysisResult result;
+    result.Status = r.getEnum(AnalysisStatus::cancelled);
+    for (auto* v : { &result.Alive, &result.Coherent, &result.Safe, &result.Reachable }) {
+      *v = r.getEnum(Verdict::no);
+    }
+    result.Deadlock = r.getWitness();
+    result.Unbounded = r.getWitness();
+    result.DeadEvents = r.getNames();
+    result.Disconnected = r.getNames();
+    auto& s = result.Statistics;
+    for (auto* v : { &s.States, &s.Frontier, &s.TerminalStates, &s.OmegaNodes, &s.Memory, &s.PeakMemory }) {
+      *v = r.get();
+    }
+    s.Duration = chrono::milliseconds(r.get());
+    result.Timings.Exploration = chrono::microseconds(r.get());
+    result.Timings.Verdicts = chrono::microseconds(r.get());
+    result.Timings.Connectivity = chrono::microseconds(r.get());
+    if (!r.finished()) {
+      throw runtime_error("ResultCache: value is damaged");
+    }
+    return result;
+  }
+
+} // namespace
+
+// Exclusive lock of the index.
+class ResultCache::Lock {
+public:
+  explicit Lock(const ResultCache& c) : _lock(c._mutex), _cache(c) {
+#if !defined(_WIN32)
+    while (flock(_cache._file, LOCK_EX) != 0) {
+      if (errno != EINTR) {
+        throw runtime_error("ResultCache: index can't be locked");
+      }
+    }
+#endif
+  }
+  ~Lock() {
+#if !defined(_WIN32)
+    flock(_cache._file, LOCK_UN);
+#endif
+  }
+  IndexHeader& header() const noexcept {
+    return *reinterpret_cast<IndexHeader*>(_cache._index);
+  }
+  IndexEntry* entries() const noexcept {
+    return reinterpret_cast<IndexEntry*>(_cache._index + sizeof(IndexHeader));
+  }
+  // entry with the key or free entry or the least recently used entry
+  size_t locate(const Fingerprint& k, bool& found) const noexcept {
+    const IndexEntry* e = entries();
+    size_t free = SIZE_MAX, oldest = 0;
+    for (size_t i = 0; i < header().Entries; i++) {
+      if (e[i].Bytes == 0) {
+        free = min(free, i);
+      }
+      else if (e[i].High == k.High && e[i].Low == k.Low) {
+        found = true;
+        return i;
+      }
+      else if (e[i].LastUse < e[oldest].LastUse || e[oldest].Bytes == 0) {
+        oldest = i;
+      }
+    }
+    found = false;
+    return free != SIZE_MAX ? free : oldest;
+  }
+private:
+  lock_guard<mutex> _lock;
+  const ResultCache& _cache;
+};
+
+// Constructor of des::ResultCache object.
+ResultCache::ResultCache(const string& d, uint64_t s, uint32_t n) : _directory(d), _limit(s),
+  _counter(static_cast<uint64_t>(random_device()()) << 32) {
+  if (n == 0) {
+    throw runtime_error("ResultCache: quantity of index entries is zero");
+  }
+  error_code e;
+  fs::create_directories(_directory, e);
+  const string path = (fs::path(_directory) / index_name).string();
+#if defined(_WIN32)
+  throw runtime_error("ResultCache: shared index isn't supported on this platform " + path);
+#else
+  _file = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (_file < 0) {
+    throw runtime_error("ResultCache: index can't be opened " + path);
+  }
+  try {
+    {
+      lock_guard<mutex> lock(_mutex);
+      if (flock(_file, LOCK_EX) != 0) {
+        throw runtime_error("ResultCache: index can't be locked " + path);
+      }
+      struct stat st;
+      bool valid = fstat(_file, &st) == 0;
+      if (valid && st.st_size == 0) { // the first process creates the index
+        IndexHeader h;
+        h.Entries = n;
+        _index_size = sizeof(IndexHeader) + n * sizeof(IndexEntry);
+        valid = ftruncate(_file, static_cast<off_t>(_index_size)) == 0 &&
+          pwrite(_file, &h, sizeof(h), 0) == static_cast<ssize_t>(sizeof(h));
+      }
+      else if (valid) {
+        IndexHeader h, expected;
+        valid = st.st_size >= static_cast<off_t>(sizeof(IndexHeader)) &&
+          pread(_file, &h, sizeof(h), 0) == static_cast<ssize_t>(sizeof(h)) &&
+          memcmp(h.Magic, expected.Magic, sizeof(h.Magic)) == 0 && h.Version == expected.Version &&
+          h.ByteOrder == expected.ByteOrder && h.Entries > 0 &&
+          static_cast<uint64_t>(st.st_size) == sizeof(IndexHeader) + uint64_t(h.Entries) * sizeof(IndexEntry);
+        _index_size = static_cast<size_t>(st.st_size);
+      }
+      flock(_file, LOCK_UN);
+      if (!valid) {
+        throw runtime_error("ResultCache: index is invalid " + path);
+      }
+    }
+    void* m = mmap(nullptr, _index_size, PROT_READ | PROT_WRITE, MAP_SHARED, _file, 0);
+    if (m == MAP_FAILED) {
+      throw runtime_error("ResultCache: index can't be mapped " + path);
+    }
+    _index = static_cast<char*>(m);
+  }
+  catch (...) {
+    close(_file);
+    throw;
+  }
+#endif
+}
+
+// Destructor of des::ResultCache object.
+ResultCache::~ResultCache() {
+#if !defined(_WIN32)
+  munmap(_index, _index_size);
+  close(_file);
+#endif
+}
+
+// Search of result.
+optional<AnalysisResult> ResultCache::find(const Fingerprint& f, const AnalysisOptions& o) {
+  const Fingerprint k = makeKey(f, o);
+  {
+    const Lock lock(*this);
+    bool found = false;
+    const size_t i = lock.locate(k, found);
+    if (!found) {
+      return nullopt;
+    }
+    lock.entries()[i].LastUse = ++lock.header().Clock;
+  }
+  ifstream file(valuePath(k), ios::binary); // renamed files are complete, evicted files can be read while open
+  string data((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+  try {
+    if (!file.bad()) {
+      return deserialize(k, data);
+    }
+  }
+  catch (const runtime_error&) {
+  }
+  const Lock lock(*this); // the value is lost or damaged
+  bool found = false;
+  const size_t i = lock.locate(k, found);
+  if (found) {
+    evict(i);
+  }
+  return nullopt;
+}
+
+// Storing of result.
+bool ResultCache::insert(const Fingerprint& f, const AnalysisOptions& o, const AnalysisResult& r) {
+  if (!cacheable(r)) {
+    return false;
+  }
+  const Fingerprint k = makeKey(f, o);
+  const string data = serialize(k, r);
+  if (data.size() > _limit) {
+    return false;
+  }
+  const string path = valuePath(k);
+  string temporary;
+  {
+    lock_guard<mutex> lock(_mutex);
+    temporary = path + ".tmp" + to_string(_counter++);
+  }
+  {
+    ofstream file(temporary, ios::binary | ios::trunc);
+    file.write(data.data(), static_cast<streamsize>(data.size()));
+    file.close();
+    error_code e;
+    if (!file || (fs::rename(temporary, path, e), e)) {
+      fs::remove(temporary, e);
+      return false;
+    }
+  }
+  const Lock lock(*this);
+  bool found = false;
+  size_t i = lock.locate(k, found);
+  IndexHeader& h = lock.header();
+  if (found) {
+    h.Bytes -= lock.entries()[i].Bytes;
+  }
+  else if (lock.entries()[i].Bytes) { // the index is full
+    evict(i);
+  }
+  IndexEntry& entry = lock.entries()[i];
+  entry = { k.High, k.Low, data.size(), ++h.Clock };
+  h.Bytes += entry.Bytes;
+  while (h.Bytes > _limit) { // the least recently used values are evicted
+    size_t oldest = i;
+    for (size_t j = 0; j < h.Entries; j++) {
+      const IndexEntry& x = lock.entries()[j];
+      if (x.Bytes && x.LastUse < lock.entries()[oldest].LastUse) {
+        oldest = j;
+      }
+    }
+    evict(oldest);
+  }
+  return true;
+}
+
+// Removal of all results.
+void ResultCache::clear() {
+  const Lock lock(*this);
+  for (size_t i = 0; i < lock.header().Entries; i++) {
+    if (lock.entries()[i].Bytes) {
+      evict(i);
+    }
+  }
+}
+
+// Quantity of results.
+size_t ResultCache::size() const {
+  const Lock lock(*this);
+  size_t result = 0;
+  for (size_t i = 0; i < lock.header().Entries; i++) {
+    result += lock.entries()[i].Bytes ? 1 : 0;
+  }
+  return result;
+}
+
+// Total size of results.
+uint64_t ResultCache::bytes() const {
+  const Lock lock(*this);
+  return lock.header().Bytes;
+}
+
+// Check of deterministic result.
+bool ResultCache::cacheable(const AnalysisResult& r) noexcept {
+  return r.Status == AnalysisStatus::complete || r.Status == AnalysisStatus::memoryLimit ||
+    r.Status == AnalysisStatus::stateLimit;
+}
+
+// Path of value file.
+string ResultCache::valuePath(const Fingerprint& k) const {
+  return (fs::path(_directory) / (k.toString() + value_extension)).string();
+}
+
+// Removal of index entry.
+void ResultCache::evict(size_t i) noexcept {
+  IndexHeader& h = *reinterpret_cast<IndexHeader*>(_index);
+  IndexEntry& e = reinterpret_cast<IndexEntry*>(_index + sizeof(IndexHeader))[i];
+  error_code c;
+  fs::remove(valuePath({ e.High, e.Low }), c);
+  h.Bytes -= e.Bytes;
+  e = IndexEntry();
+}
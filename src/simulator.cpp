@@ -0,0 +1,179 @@
+/*! @file simulator.cpp
+@ref des::Simulator class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <chrono>
+#include <stdexcept>
+
+#include "simulator.hpp"
+#include "splitmix.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Random number less than the bound by multiplication of the upper half of random number.
+  uint32_t bounded(uint64_t r, size_t n) noexcept {
+    return static_cast<uint32_t>(((r >> 32) * n) >> 32);
+  }
+
+} // namespace
+
+// Constructor of des::Simulator object.
+Simulator::Simulator(const CompiledNet& n, const SimulatorOptions& o) : _net(n), _options(o), _marking(),
+  _missing(n.getEventQuantity()), _ready(n.getEventQuantity()), _positions(n.getEventQuantity()),
+  _candidates(n.getEventQuantity()), _firings(n.getEventQuantity()), _token_sums(n.getStateQuantity()),
+  _changes(n.getStateQuantity()) {
+  if (o.Priorities.size() > n.getEventQuantity()) {
+    throw invalid_argument("Simulator: priorities of absent events");
+  }
+  _options.Priorities.resize(n.getEventQuantity(), 0);
+  reset();
+}
+
+// Return into the initial marking.
+void Simulator::reset() {
+  _marking = _net.getInitialMarking();
+  _ready_size = 0;
+  for (size_t t = 0; t < _net.getEventQuantity(); t++) {
+    _missing[t] = _net.getMissingInputs(_marking, t);
+    if (_missing[t] == 0) {
+      _positions[t] = static_cast<uint32_t>(_ready_size);
+      _ready[_ready_size++] = static_cast<uint32_t>(t);
+    }
+  }
+  fill(_firings.begin(), _firings.end(), 0);
+  fill(_token_sums.begin(), _token_sums.end(), 0);
+  fill(_changes.begin(), _changes.end(), 0);
+  _steps = 0;
+  _counter = 0;
+  _key = streamKey(_options.Seed, _options.Stream);
+  _last = _net.getEventQuantity() ? static_cast<uint32_t>(_net.getEventQuantity() - 1) : 0;
+}
+
+// Return into the initial marking with another random stream.
+void Simulator::reset(uint64_t s) {
+  _options.Stream = s;
+  reset();
+}
+
+// Sums of token quantities over all markings.
+void Simulator::getTokenSums(vector<uint64_t>& s) const {
+  s.resize(_marking.size());
+  for (size_t i = 0; i < s.size(); i++) {
+    s[i] = _token_sums[i] + static_cast<uint64_t>(_marking[i]) * (_steps + 1 - _changes[i]);
+  }
+}
+
+// Firing of one ready event.
+size_t Simulator::step() noexcept {
+  if (_ready_size == 0) {
+    return none;
+  }
+  const uint32_t t = choose();
+  for (const auto& i : _net.getEventInputs(t)) {
+    const unsigned q = _marking[i.Index];
+    if (q != omega) {
+      change(i.Index, q - i.Multiplicity);
+    }
+  }
+  for (const auto& o : _net.getEventOutputs(t)) {
+    const unsigned q = _marking[o.Index];
+    if (q != omega) {
+      change(o.Index, omega - q > o.Multiplicity ? q + o.Multiplicity : omega - 1);
+    }
+  }
+  _firings[t]++;
+  _steps++;
+  _last = t;
+  return t;
+}
+
+// Firing of events until the quantity of steps or a deadlock.
+SimulationResult Simulator::run(uint64_t n) {
+  SimulationResult result;
+  const auto start = chrono::steady_clock::now();
+  while (result.Steps < n && step() != none) {
+    result.Steps++;
+  }
+  result.Seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  result.Deadlock = _ready_size == 0;
+  if (result.Seconds > 0.0) {
+    result.FiringsPerSecond = static_cast<double>(result.Steps) / result.Seconds;
+  }
+  return result;
+}
+
+// Next random number of splitmix64 generator.
+uint64_t Simulator::generate() noexcept {
+  return mix64(_key + ++_counter * golden_gamma);
+}
+
+// Choice of ready event by the policy.
+uint32_t Simulator::choose() noexcept {
+  switch (_options.Policy) {
+    case FiringPolicy::random:
+      break;
+    case FiringPolicy::priority: {
+      const auto& priorities = _options.Priorities;
+      size_t quantity = 0;
+      int best = 0;
+      for (size_t k = 0; k < _ready_size; k++) {
+        const uint32_t t = _ready[k];
+        if (quantity == 0 || priorities[t] > best) {
+          best = priorities[t];
+          quantity = 0;
+        }
+        if (priorities[t] == best) {
+          _candidates[quantity++] = t;
+        }
+      }
+      return quantity == 1 ? _candidates[0] : _candidates[bounded(generate(), quantity)];
+    }
+    case FiringPolicy::roundRobin: {
+      const size_t n = _net.getEventQuantity();
+      uint32_t result = _ready[0];
+      size_t distance = n;
+      for (size_t k = 0; k < _ready_size; k++) {
+        const uint32_t t = _ready[k];
+        const size_t d = t > _last ? t - _last : t + n - _last; // the last fired event is the farthest one
+        if (d < distance) {
+          distance = d;
+          result = t;
+        }
+      }
+      return result;
+    }
+  }
+  return _ready[bounded(generate(), _ready_size)];
+}
+
+// Change of token quantity and update of ready events.
+void Simulator::change(uint32_t s, unsigned q) noexcept {
+  const unsigned previous = _marking[s];
+  _marking[s] = q;
+  _token_sums[s] += static_cast<uint64_t>(previous) * (_steps + 1 - _changes[s]); // markings from the last change
+  _changes[s] = _steps + 1;
+  for (const auto& c : _net.getStateConsumers(s)) {
+    const bool before = previous >= c.Multiplicity;
+    const bool after = q >= c.Multiplicity;
+    if (before == after) {
+      continue;
+    }
+    const uint32_t t = c.Index;
+    if (after) {
+      if (--_missing[t] == 0) {
+        _positions[t] = static_cast<uint32_t>(_ready_size);
+        _ready[_ready_size++] = t;
+      }
+    }
+    else if (_missing[t]++ == 0) {
+      const uint32_t moved = _ready[--_ready_size]; // the last ready event takes place of the removed one
+      _ready[_positions[t]] = moved;
+      _positions[moved] = _positions[t];
+    }
+  }
+}
@@ -0,0 +1,321 @@
+/*! @file state_class_graph.cpp
+@ref des::StateClassGraph class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "state_class_graph.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Initial quantity of hash table slots.
+  const size_t initial_table_size = 1024;
+
+  // Sum of bounds, infinity absorbs finite bounds.
+  int64_t add(int64_t a, int64_t b) noexcept {
+    return a >= time_infinity || b >= time_infinity ? time_infinity : a + b;
+  }
+
+  // Ready events of marking in order of indexes.
+  void collectReady(const CompiledNet& n, const Marking& m, vector<uint32_t>& r) {
+    r.clear();
+    for (size_t t = 0; t < n.getEventQuantity(); t++) {
+      if (n.isReady(m, t)) {
+        r.push_back(static_cast<uint32_t>(t));
+      }
+    }
+  }
+
+} // namespace
+
+// Constructor of des::StateClassGraph object.
+StateClassGraph::StateClassGraph(const CompiledNet& n, const StateClassOptions& o) : _net(n), _options(o),
+  _max_inputs(n.getStateQuantity(), 0), _markings(n.getStateQuantity()), _class_markings(), _parents(), _events(),
+  _offsets(1, 0), _bounds(), _table(initial_table_size, 0), _ready(), _next_ready(),
+  _positions(n.getEventQuantity(), 0), _minima(), _current(), _next() {
+  if (o.Intervals.size() > n.getEventQuantity()) {
+    throw invalid_argument("StateClassGraph: intervals of absent events");
+  }
+  _options.Intervals.resize(n.getEventQuantity());
+  for (size_t t = 0; t < n.getEventQuantity(); t++) {
+    const auto& i = _options.Intervals[t];
+    if (i.Earliest < 0 || i.Earliest >= time_infinity || i.Latest < i.Earliest || i.Latest > time_infinity) {
+      throw invalid_argument("StateClassGraph: invalid interval of event " + n.getEventName(t));
+    }
+    for (const auto& a : n.getEventInputs(t)) {
+      _max_inputs[a.Index] = max(_max_inputs[a.Index], a.Multiplicity);
+    }
+  }
+}
+
+// Breadth-first construction of the graph.
+StateClassResult StateClassGraph::build() {
+  _markings = MarkingStore(_net.getStateQuantity());
+  _class_markings.clear();
+  _parents.clear();
+  _events.clear();
+  _offsets.assign(1, 0);
+  _bounds.clear();
+  _table.assign(initial_table_size, 0);
+  StateClassResult result;
+  result.Bounds = _net.getInitialMarking();
+
+  collectReady(_net, _net.getInitialMarking(), _next_ready);
+  size_t dimension = _next_ready.size() + 1;
+  _next.assign(dimension * dimension, 0);
+  for (size_t k = 1; k < dimension; k++) { // static intervals of independent times
+    const auto& i = _options.Intervals[_next_ready[k - 1]];
+    _next[k * dimension] = i.Latest;
+    _next[k] = -i.Earliest;
+  }
+  for (size_t k = 1; k < dimension; k++) {
+    for (size_t j = 1; j < dimension; j++) {
+      _next[k * dimension + j] = k == j ? 0 : add(_next[k * dimension], _next[j]);
+    }
+  }
+  insert(_markings.insert(_net.getInitialMarking()).first, dimension, none, none);
+
+  Marking m, rest, r;
+  vector<size_t> sources;
+  bool limited = false;
+  for (size_t c = 0; c < size() && result.Bounded != Boundedness::unbounded; c++) {
+    _markings.get(_class_markings[c], m);
+    collectReady(_net, m, _ready);
+    const size_t n = _ready.size() + 1;
+    if (n == 1) {
+      if (result.Deadlocks++ == 0) {
+        result.DeadlockPath = getPath(c);
+      }
+      continue;
+    }
+    _current.resize(n * n);
+    const int64_t* stored = _bounds.data() + _offsets[c];
+    for (size_t i = 0; i < n; i++) { // the diagonal is zero
+      for (size_t j = 0; j < n; j++) {
+        _current[i * n + j] = i == j ? 0 : *stored++;
+      }
+    }
+    for (size_t k = 1; k < n; k++) {
+      _positions[_ready[k - 1]] = static_cast<uint32_t>(k);
+    }
+    _minima.resize(n);
+    for (size_t j = 0; j < n; j++) {
+      int64_t minimum = time_infinity;
+      for (size_t k = 1; k < n; k++) {
+        minimum = min(minimum, _current[k * n + j]);
+      }
+      _minima[j] = minimum;
+    }
+
+    for (size_t f = 1; f < n; f++) {
+      bool firable = true;
+      for (size_t j = 1; j < n && firable; j++) {
+        firable = _current[j * n + f] >= 0; // the event can fire not later than others
+      }
+      if (!firable) {
+        continue;
+      }
+      const uint32_t t = _ready[f - 1];
+      // The domain with the event fired first: paths through new constraints t <= j, it's canonical again.
+      const auto bound = [&](size_t i, size_t j) {
+        return min(_current[i * n + j], add(_current[i * n + f], _minima[j]));
+      };
+      rest = m;
+      for (const auto& i : _net.getEventInputs(t)) {
+        rest[i.Index] = rest[i.Index] == omega ? omega : rest[i.Index] - i.Multiplicity;
+      }
+      _net.fire(m, t, r);
+      size_t marking = _markings.find(r);
+      if (marking == MarkingStore::none) {
+        if (_options.MaxClasses && size() >= _options.MaxClasses) {
+          limited = true;
+          continue;
+        }
+        marking = _markings.insert(r).first;
+      }
+      collectReady(_net, r, _next_ready);
+      dimension = _next_ready.size() + 1;
+      sources.assign(dimension, 0);
+      for (size_t a = 1; a < dimension; a++) { // persistent events keep their variables, others are newly enabled
+        const uint32_t e = _next_ready[a - 1];
+        sources[a] = e != t && _net.isReady(rest, e) ? _positions[e] : 0;
+      }
+      _next.assign(dimension * dimension, 0);
+      for (size_t a = 1; a < dimension; a++) { // times of persistent events are shifted by the firing time
+        const auto& i = _options.Intervals[_next_ready[a - 1]];
+        _next[a * dimension] = sources[a] ? bound(sources[a], f) : i.Latest;
+        _next[a] = sources[a] ? bound(f, sources[a]) : -i.Earliest;
+      }
+      for (size_t a = 1; a < dimension; a++) {
+        for (size_t b = 1; b < dimension; b++) { // newly enabled time is independent of others
+          if (a != b) {
+            _next[a * dimension + b] = sources[a] && sources[b] ? bound(sources[a], sources[b]) :
+              add(_next[a * dimension], _next[b]);
+          }
+        }
+      }
+      const auto added = insert(marking, dimension, c, t);
+      if (added.first == none) {
+        limited = true;
+        continue;
+      }
+      result.Edges++;
+      if (added.second) {
+        for (size_t s = 0; s < r.size(); s++) {
+          result.Bounds[s] = max(result.Bounds[s], r[s]);
+        }
+        if (unbounded(added.first)) {
+          result.Bounded = Boundedness::unbounded;
+          break;
+        }
+      }
+    }
+    for (const auto e : _ready) {
+      _positions[e] = 0;
+    }
+  }
+  result.Complete = !limited && result.Bounded != Boundedness::unbounded;
+  if (result.Complete) {
+    result.Bounded = Boundedness::bounded;
+  }
+  result.Classes = size();
+  result.Markings = _markings.size();
+  return result;
+}
+
+// Marking copy.
+void StateClassGraph::getMarking(size_t i, Marking& m) const {
+  _markings.get(_class_markings.at(i), m);
+}
+
+// Firing interval of ready event.
+TimeInterval StateClassGraph::getFiringInterval(size_t i, size_t t) const {
+  Marking m;
+  getMarking(i, m);
+  if (t >= _net.getEventQuantity() || !_net.isReady(m, t)) {
+    throw out_of_range("getFiringInterval: the event isn't ready in the class");
+  }
+  size_t n = 1, k = 1; // the variable of the event follows variables of ready events with less indexes
+  for (size_t e = 0; e < _net.getEventQuantity(); e++) {
+    if (_net.isReady(m, e)) {
+      n++;
+      k += e < t ? 1 : 0;
+    }
+  }
+  const int64_t* d = _bounds.data() + _offsets[i];
+  const auto at = [&](size_t r, size_t c) { // the row of stored matrix hasn't the diagonal item
+    return d[r * (n - 1) + (c < r ? c : c - 1)];
+  };
+  return { -at(0, k), at(k, 0) };
+}
+
+// Firing sequence from the initial class.
+vector<size_t> StateClassGraph::getPath(size_t i) const {
+  vector<size_t> result;
+  for (size_t c = i; _parents[c] != UINT32_MAX; c = _parents[c]) {
+    result.push_back(_events[c]);
+  }
+  reverse(result.begin(), result.end());
+  return result;
+}
+
+// Class addition.
+pair<size_t, bool> StateClassGraph::insert(size_t m, size_t dimension, size_t p, size_t e) {
+  const size_t s = dimension * (dimension - 1);
+  const size_t begin = _bounds.size();
+  for (size_t i = 0; i < dimension; i++) { // the compact matrix is appended and removed, if the class exists
+    for (size_t j = 0; j < dimension; j++) {
+      if (i != j) {
+        _bounds.push_back(_next[i * dimension + j]);
+      }
+    }
+  }
+  const int64_t* d = _bounds.data() + begin;
+  const size_t mask = _table.size() - 1;
+  size_t slot = hash(m, d, s) & mask;
+  while (_table[slot]) {
+    const size_t c = _table[slot] - 1;
+    if (_class_markings[c] == m && _offsets[c + 1] - _offsets[c] == s &&
+      memcmp(_bounds.data() + _offsets[c], d, s * sizeof(int64_t)) == 0) {
+      _bounds.resize(begin);
+      return { c, false };
+    }
+    slot = (slot + 1) & mask;
+  }
+  if (_options.MaxClasses && size() >= _options.MaxClasses) {
+    _bounds.resize(begin);
+    return { static_cast<size_t>(none), false };
+  }
+  if (size() >= none - 1) {
+    throw length_error("insert: quantity of classes exceeds 32-bit numbers");
+  }
+  const size_t i = size();
+  _class_markings.push_back(static_cast<uint32_t>(m));
+  _parents.push_back(static_cast<uint32_t>(p));
+  _events.push_back(static_cast<uint32_t>(e));
+  _offsets.push_back(_bounds.size());
+  _table[slot] = static_cast<uint32_t>(i + 1);
+  if (2 * size() > _table.size()) {
+    grow(); // load factor is at most one half
+  }
+  return { i, true };
+}
+
+// Hash of class (FNV-1a over marking number and bounds with final mixing).
+uint64_t StateClassGraph::hash(size_t m, const int64_t* d, size_t s) const noexcept {
+  uint64_t h = (14695981039346656037ull ^ m) * 1099511628211ull;
+  for (size_t i = 0; i < s; i++) {
+    h = (h ^ static_cast<uint64_t>(d[i])) * 1099511628211ull;
+  }
+  h ^= h >> 32;
+  h *= 0xd6e8feb86659fd93ull;
+  return h ^ (h >> 32);
+}
+
+// Check of the sufficient condition of unboundedness by Berthomieu and Diaz.
+bool StateClassGraph::unbounded(size_t i) const {
+  const unsigned* m = _markings.data(_class_markings[i]);
+  const int64_t* d = _bounds.data() + _offsets[i];
+  const size_t s = _offsets[i + 1] - _offsets[i];
+  for (size_t a = _parents[i]; a != UINT32_MAX; a = _parents[a]) {
+    if (_offsets[a + 1] - _offsets[a] != s || memcmp(_bounds.data() + _offsets[a], d, s * sizeof(int64_t)) != 0) {
+      continue;
+    }
+    const unsigned* ancestor = _markings.data(_class_markings[a]);
+    bool greater = false, covering = true;
+    for (size_t p = 0; p < _net.getStateQuantity() && covering; p++) {
+      if (m[p] < ancestor[p]) {
+        covering = false;
+      }
+      else if (m[p] > ancestor[p]) {
+        greater = true;
+        covering = ancestor[p] > _max_inputs[p]; // added tokens don't change ready events
+      }
+    }
+    if (covering && greater) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Hash table doubling.
+void StateClassGraph::grow() {
+  vector<uint32_t> table(_table.size() * 2, 0);
+  const size_t mask = table.size() - 1;
+  for (size_t i = 0; i < size(); i++) {
+    size_t slot = hash(_class_markings[i], _bounds.data() + _offsets[i], _offsets[i + 1] - _offsets[i]) & mask;
+    while (table[slot]) {
+      slot = (slot + 1) & mask;
+    }
+    table[slot] = static_cast<uint32_t>(i + 1);
+  }
+  _table.swap(table);
+}
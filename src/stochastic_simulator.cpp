@@ -0,0 +1,254 @@
+/*! @file stochastic_simulator.cpp
+@ref des::StochasticSimulator class source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+#include "splitmix.hpp"
+#include "stochastic_simulator.hpp"
+
+
+using namespace std;
+using namespace des;
+
+namespace {
+
+  // Check of delay parameters.
+  bool valid(const FiringDelay& d) {
+    switch (d.Type) {
+      case DelayType::exponential:
+        return d.Rate > 0.0 && isfinite(d.Rate);
+      case DelayType::deterministic:
+        return d.Value >= 0.0 && isfinite(d.Value);
+      case DelayType::uniform:
+        return d.Min >= 0.0 && d.Min <= d.Max && isfinite(d.Max);
+      case DelayType::general:
+        return static_cast<bool>(d.Quantile);
+    }
+    return false;
+  }
+
+} // namespace
+
+// Constructor of des::StochasticSimulator object.
+StochasticSimulator::StochasticSimulator(const CompiledNet& n, const StochasticSimulatorOptions& o) : _net(n),
+  _options(o), _marking(), _missing(n.getEventQuantity()), _heap(), _positions(n.getEventQuantity()),
+  _firings(n.getEventQuantity()), _token_sums(n.getStateQuantity()), _busy_sums(n.getStateQuantity()),
+  _changes(n.getStateQuantity()) {
+  if (o.Delays.size() > n.getEventQuantity()) {
+    throw invalid_argument("StochasticSimulator: delays of absent events");
+  }
+  _options.Delays.resize(n.getEventQuantity());
+  for (size_t t = 0; t < n.getEventQuantity(); t++) {
+    if (!valid(_options.Delays[t])) {
+      throw invalid_argument("StochasticSimulator: invalid delay of event " + n.getEventName(t));
+    }
+  }
+  _heap.reserve(n.getEventQuantity());
+  reset();
+}
+
+// Return into the initial marking at zero time.
+void StochasticSimulator::reset() {
+  _marking = _net.getInitialMarking();
+  _time = 0.0;
+  _steps = 0;
+  _counter = 0;
+  _key = streamKey(_options.Seed, _options.Stream); // the same streams as des::Simulator has
+  fill(_firings.begin(), _firings.end(), 0);
+  fill(_token_sums.begin(), _token_sums.end(), 0.0);
+  fill(_busy_sums.begin(), _busy_sums.end(), 0.0);
+  fill(_changes.begin(), _changes.end(), 0.0);
+  fill(_positions.begin(), _positions.end(), static_cast<uint32_t>(none));
+  _heap.clear();
+  for (size_t t = 0; t < _net.getEventQuantity(); t++) {
+    _missing[t] = _net.getMissingInputs(_marking, t);
+    if (_missing[t] == 0) {
+      schedule(static_cast<uint32_t>(t));
+    }
+  }
+}
+
+// Firing of the earliest scheduled event.
+size_t StochasticSimulator::step() {
+  if (_heap.empty()) {
+    return none;
+  }
+  const uint32_t t = _heap.front().Event;
+  _time = _heap.front().Time;
+  const auto& inputs = _net.getEventInputs(t);
+  const auto& outputs = _net.getEventOutputs(t);
+  const Arc* i = inputs.begin();
+  const Arc* o = outputs.begin();
+  while (i != inputs.end() || o != outputs.end()) { // links are ordered by states, each state changes once
+    const uint32_t s = o == outputs.end() || (i != inputs.end() && i->Index < o->Index) ? i->Index : o->Index;
+    unsigned q = _marking[s];
+    if (i != inputs.end() && i->Index == s) {
+      q = q == omega ? q : q - i->Multiplicity;
+      i++;
+    }
+    if (o != outputs.end() && o->Index == s) {
+      q = q == omega ? q : omega - q > o->Multiplicity ? q + o->Multiplicity : omega - 1;
+      o++;
+    }
+    if (q != _marking[s]) {
+      change(s, q);
+    }
+  }
+  if (_positions[t] != none) { // the event stays ready, its time increases in place
+    _heap[_positions[t]].Time = _time + delay(t);
+    siftDown(_positions[t]);
+  }
+  _firings[t]++;
+  _steps++;
+  return t;
+}
+
+// Firing of events until the quantity of steps, the horizon or a deadlock.
+StochasticResult StochasticSimulator::run(uint64_t n, double h) {
+  const auto start = chrono::steady_clock::now();
+  for (uint64_t k = 0; k < n && !_heap.empty() && _heap.front().Time <= h; k++) {
+    step();
+  }
+  StochasticResult result;
+  result.Seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  result.Deadlock = _heap.empty();
+  if (!_heap.empty() && _heap.front().Time > h && h > _time) {
+    _time = h; // nothing fires until the horizon
+  }
+  result.Steps = _steps;
+  result.Time = _time;
+  result.Throughputs.assign(_firings.size(), 0.0);
+  result.MeanTokens.assign(_marking.size(), 0.0);
+  result.BusyShares.assign(_marking.size(), 0.0);
+  if (_time > 0.0) {
+    for (size_t t = 0; t < _firings.size(); t++) {
+      result.Throughputs[t] = static_cast<double>(_firings[t]) / _time;
+    }
+    for (size_t s = 0; s < _marking.size(); s++) {
+      const double held = _time - _changes[s]; // the current token quantity is held since the last change
+      result.MeanTokens[s] = (_token_sums[s] + _marking[s] * held) / _time;
+      result.BusyShares[s] = (_busy_sums[s] + (_marking[s] ? held : 0.0)) / _time;
+    }
+  }
+  if (result.Seconds > 0.0) {
+    result.FiringsPerSecond = static_cast<double>(_steps) / result.Seconds;
+  }
+  return result;
+}
+
+// Firing time of scheduled event.
+double StochasticSimulator::getFiringTime(size_t t) const noexcept {
+  return _positions[t] == none ? numeric_limits<double>::infinity() : _heap[_positions[t]].Time;
+}
+
+// Random number from (0, 1) by 53 upper bits of splitmix64 generator.
+double StochasticSimulator::uniform() noexcept {
+  return (static_cast<double>(mix64(_key + ++_counter * golden_gamma) >> 11) + 0.5) * 0x1p-53;
+}
+
+// Random delay of event.
+double StochasticSimulator::delay(uint32_t t) {
+  const FiringDelay& d = _options.Delays[t];
+  switch (d.Type) {
+    case DelayType::exponential:
+      return -log(uniform()) / d.Rate;
+    case DelayType::deterministic:
+      return d.Value;
+    case DelayType::uniform:
+      return d.Min + (d.Max - d.Min) * uniform();
+    case DelayType::general:
+      return d.Quantile(uniform());
+  }
+  return 0.0;
+}
+
+// Addition of event into the heap.
+void StochasticSimulator::schedule(uint32_t t) {
+  _positions[t] = static_cast<uint32_t>(_heap.size());
+  _heap.push_back({ _time + delay(t), t });
+  siftUp(_heap.size() - 1);
+}
+
+// Removal of event from the heap.
+void StochasticSimulator::cancel(uint32_t t) {
+  const size_t p = _positions[t];
+  _positions[t] = static_cast<uint32_t>(none);
+  const Scheduled last = _heap.back();
+  _heap.pop_back();
+  if (p == _heap.size()) {
+    return; // the last item is removed
+  }
+  _heap[p] = last; // the last item takes place of the removed one and moves up or down
+  _positions[last.Event] = static_cast<uint32_t>(p);
+  if (p > 0 && last.Time < _heap[(p - 1) / 2].Time) {
+    siftUp(p);
+  }
+  else {
+    siftDown(p);
+  }
+}
+
+// Moving of heap item towards the root.
+void StochasticSimulator::siftUp(size_t p) noexcept {
+  const Scheduled item = _heap[p];
+  while (p > 0) {
+    const size_t parent = (p - 1) / 2;
+    if (!(item.Time < _heap[parent].Time)) {
+      break;
+    }
+    _heap[p] = _heap[parent];
+    _positions[_heap[p].Event] = static_cast<uint32_t>(p);
+    p = parent;
+  }
+  _heap[p] = item;
+  _positions[item.Event] = static_cast<uint32_t>(p);
+}
+
+// Moving of heap item towards leaves.
+void StochasticSimulator::siftDown(size_t p) noexcept {
+  const Scheduled item = _heap[p];
+  const size_t size = _heap.size();
+  for (size_t child = 2 * p + 1; child < size; child = 2 * p + 1) {
+    if (child + 1 < size && _heap[child + 1].Time < _heap[child].Time) {
+      child++;
+    }
+    if (!(_heap[child].Time < item.Time)) {
+      break;
+    }
+    _heap[p] = _heap[child];
+    _positions[_heap[p].Event] = static_cast<uint32_t>(p);
+    p = child;
+  }
+  _heap[p] = item;
+  _positions[item.Event] = static_cast<uint32_t>(p);
+}
+
+// Change of token quantity, occupancy sums and ready events.
+void StochasticSimulator::change(uint32_t s, unsigned q) {
+  const unsigned previous = _marking[s];
+  const double held = _time - _changes[s];
+  _token_sums[s] += previous * held;
+  _busy_sums[s] += previous ? held : 0.0;
+  _changes[s] = _time;
+  _marking[s] = q;
+  for (const auto& c : _net.getStateConsumers(s)) {
+    const bool before = previous >= c.Multiplicity;
+    const bool after = q >= c.Multiplicity;
+    if (before == after) {
+      continue;
+    }
+    const uint32_t t = c.Index;
+    if (after) {
+      if (--_missing[t] == 0) {
+        schedule(t);
+      }
+    }
+    else if (_missing[t]++ == 0) {
+      cancel(t);
+    }
+  }
+}
@@ -0,0 +1,141 @@
+/*! @file analyse_tests.cpp
+Analyser class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "analyse.hpp"
+#include "test_nets.hpp"
+
+
+// Test of complete analysis.
+BOOST_AUTO_TEST_CASE(AnalyseCycle) {
+  des::Automation a = makeRing(5);
+  Analyser an;
+  const auto r = an.run_analyse(a);
+  BOOST_CHECK(!r.inconclusive());
+  BOOST_CHECK(r.Alive == des::Verdict::yes);
+  BOOST_CHECK(r.Coherent == des::Verdict::yes);
+  BOOST_CHECK(r.Safe == des::Verdict::yes);
+  BOOST_CHECK(r.Reachable == des::Verdict::yes);
+  BOOST_CHECK(!r.Deadlock);
+  BOOST_CHECK(!r.Unbounded);
+  BOOST_CHECK(r.DeadEvents.empty());
+  BOOST_CHECK(r.Disconnected.empty());
+  BOOST_CHECK(r.Statistics.States == 5);
+  BOOST_CHECK(r.Statistics.Frontier == 0);
+  BOOST_CHECK(r.Statistics.Memory > 0);
+  BOOST_CHECK(r.Statistics.PeakMemory >= r.Statistics.Memory);
+}
+
+// Test of witnesses of violations.
+BOOST_AUTO_TEST_CASE(AnalyseWitnesses) {
+  des::Automation a;
+  a.addState("p1", 1);
+  a.addState("p2");
+  a.addState("p3");
+  a.addState("p4");
+  a.addEvent("t1", des::EventType::controllable);
+  a.addEvent("t2", des::EventType::controllable);
+  a.addEvent("t3", des::EventType::controllable);
+  a.addEvent("t4", des::EventType::controllable);
+  a.linkStatesByEvent("p1", "t1", "p2");
+  a.linkStatesByEvent("p2", "t2", "p3"); // p3 is terminal
+  a.setLinkFromStateToEvent("p2", "t3");
+  a.setLinkFromEventToState("t3", "p2");
+  a.setLinkFromEventToState("t3", "p4"); // p4 is unbounded
+  a.setLinkFromStateToEvent("p3", "t4", 2); // t4 never fires
+  Analyser an;
+  const auto r = an.run_analyse(a);
+  BOOST_CHECK(r.Alive == des::Verdict::no);
+  BOOST_CHECK(r.Safe == des::Verdict::no);
+  BOOST_CHECK(r.Reachable == des::Verdict::no);
+  BOOST_REQUIRE(r.Deadlock);
+  BOOST_CHECK((r.Deadlock->Events == std::vector<std::string>{ "t1", "t2" }));
+  BOOST_CHECK(r.Deadlock->Marking.at("p3") == 1);
+  BOOST_REQUIRE(r.Unbounded);
+  BOOST_CHECK((r.Unbounded->Events == std::vector<std::string>{ "t1", "t3" }));
+  BOOST_CHECK(r.Unbounded->Marking.at("p4") == des::omega);
+  BOOST_CHECK(r.DeadEvents == std::set<std::string>{ "t4" });
+  a.addState("q_alone");
+  const auto d = an.run_analyse(a);
+  BOOST_CHECK(d.Coherent == des::Verdict::no);
+  BOOST_CHECK(d.Disconnected == std::set<std::string>{ "q_alone" });
+}
+
+// Test of analysis limits.
+BOOST_AUTO_TEST_CASE(AnalyseLimits) {
+  des::Automation a = makeRing(20);
+  Analyser an;
+  des::AnalysisOptions o;
+  o.MaxStates = 3;
+  auto r = an.run_analyse(a, o);
+  BOOST_CHECK(r.Status == des::AnalysisStatus::stateLimit);
+  BOOST_CHECK(r.Statistics.States == 3);
+  BOOST_CHECK(r.Statistics.Frontier == 1);
+  BOOST_CHECK(r.Coherent == des::Verdict::yes);
+  BOOST_CHECK(r.Alive == des::Verdict::unknown);
+  BOOST_CHECK(r.Reachable == des::Verdict::unknown);
+  BOOST_CHECK(r.Safe == des::Verdict::unknown);
+  o.MaxStates = 0;
+  o.MaxMemory = 1;
+  r = an.run_analyse(a, o);
+  BOOST_CHECK(r.Status == des::AnalysisStatus::memoryLimit);
+  des::CancellationToken c;
+  c.cancel();
+  o.MaxMemory = 0;
+  o.Cancellation = &c;
+  r = an.run_analyse(a, o);
+  BOOST_CHECK(r.Status == des::AnalysisStatus::cancelled);
+  BOOST_CHECK(r.Statistics.States == 0);
+  c.reset();
+  r = an.run_analyse(a, o); // analyser keeps no state between analyses
+  BOOST_CHECK(!r.inconclusive());
+  BOOST_CHECK(r.Statistics.States == 20);
+}
+
+// Test of progress callback.
+BOOST_AUTO_TEST_CASE(AnalyseProgress) {
+  des::Automation a = makeRing(10);
+  Analyser an;
+  des::AnalysisOptions o;
+  std::vector<des::AnalysisProgress> reports;
+  o.Progress = [&reports](const des::AnalysisProgress& p) { reports.push_back(p); };
+  o.ProgressInterval = std::chrono::milliseconds(0);
+  an.run_analyse(a, o);
+  BOOST_REQUIRE(reports.size() >= 2); // at the start and after the analysis
+  BOOST_CHECK(reports.front().States == 0);
+  BOOST_CHECK(reports.back().States == 10);
+  BOOST_CHECK(reports.back().Frontier == 0);
+  BOOST_CHECK(reports.back().OmegaNodes == 0);
+}
+
+// Test of parallel analysis of several nets.
+BOOST_AUTO_TEST_CASE(AnalyseBatch) {
+  std::vector<des::Automation> models;
+  for (unsigned i = 1; i <= 16; i++) {
+    models.push_back(makeRing(i));
+  }
+  models.push_back(models.back()); // the same net is analysed twice
+  models.back().addState("q_alone");
+  const Analyser an;
+  const auto r = an.run_batch(models, des::AnalysisOptions(), 4);
+  BOOST_REQUIRE(r.size() == models.size());
+  for (size_t i = 0; i < models.size(); i++) {
+    const auto s = an.run_analyse(models[i]);
+    BOOST_CHECK(r[i].Statistics.States == s.Statistics.States);
+    BOOST_CHECK(r[i].Alive == s.Alive);
+    BOOST_CHECK(r[i].Coherent == s.Coherent);
+  }
+  BOOST_CHECK(r[15].Statistics.States == 16);
+  BOOST_CHECK(r[16].Coherent == des::Verdict::no);
+  BOOST_CHECK(an.run_batch({}).empty());
+  des::CancellationToken c;
+  c.cancel();
+  des::AnalysisOptions o;
+  o.Cancellation = &c;
+  for (const auto& i : an.run_batch(models, o)) {
+    BOOST_CHECK(i.Status == des::AnalysisStatus::cancelled);
+  }
+}
@@ -0,0 +1,113 @@
+/*! @file automation_builder_tests.cpp
+@ref des::AutomationBuilder class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <memory_resource>
+
+#include <boost/test/unit_test.hpp>
+
+#include "automation_builder.hpp"
+
+
+// Test of automation building by indexes and by names.
+BOOST_AUTO_TEST_CASE(BuildAutomation) {
+  des::AutomationBuilder b;
+  const size_t p2 = b.addState("p2");
+  const size_t p1 = b.addState("p1", 2);
+  const size_t t1 = b.addEvent("t1");
+  b.addEvent("t2", des::EventType::uncontrollable);
+  des::Event m(des::EventType::macro);
+  m.addMaskedEvent("t1");
+  b.addEvent("macro", m);
+  b.addLinkFromStateToEvent(p1, t1, 2);
+  b.addLinkFromEventToState(t1, p2);
+  b.addLinkFromEventToState(t1, p2, 2); // parallel links are merged
+  b.addLinkFromStateToEvent("p2", "t2");
+  b.addLinkFromEventToState("t2", "p1");
+  b.addLinkFromStateToEvent(p2, t1, 0);
+  BOOST_CHECK(b.getLinkQuantity() == 6);
+  const des::Automation a = b.build();
+  BOOST_CHECK(b.getStateQuantity() == 0 && b.getEventQuantity() == 0 && b.getLinkQuantity() == 0);
+  BOOST_CHECK((a.getStateNameSet() == std::set<std::string>{ "p1", "p2" }));
+  BOOST_CHECK((a.getEventNameSet() == std::set<std::string>{ "macro", "t1", "t2" }));
+  BOOST_CHECK(a.getActivity("p1") == 2);
+  BOOST_CHECK(a.getType("t2") == des::EventType::uncontrollable);
+  BOOST_CHECK(a.getLinksFromStateToEvent("p1", "t1") == 2);
+  BOOST_CHECK(a.getLinksFromEventToState("t1", "p2") == 3);
+  BOOST_CHECK(a.getLinksFromStateToEvent("p2", "t1") == 0);
+  BOOST_CHECK((a.getStateInputs("p2") == std::set<std::string>{ "t1" }));
+  BOOST_CHECK((a.getStateOutputs("p2") == std::set<std::string>{ "t2" }));
+  BOOST_CHECK((a.getEventInputs("t2") == std::set<std::string>{ "p2" }));
+  BOOST_CHECK(a.checkMacro());
+  BOOST_CHECK(a.getReadyEvents() == std::set<std::string>{ "t1" });
+}
+
+// Test of deferred validation.
+BOOST_AUTO_TEST_CASE(BuildInvalidAutomation) {
+  des::AutomationBuilder b;
+  b.addState("1p");
+  BOOST_CHECK_THROW((void)b.build(), std::invalid_argument);
+  b = des::AutomationBuilder();
+  b.addState("p");
+  b.addEvent("t");
+  b.addState("p");
+  BOOST_CHECK_THROW((void)b.build(), std::invalid_argument);
+  b = des::AutomationBuilder();
+  b.addState("p");
+  b.addEvent("t");
+  b.addLinkFromStateToEvent("p", "u");
+  BOOST_CHECK_THROW((void)b.build(), std::invalid_argument);
+  b = des::AutomationBuilder();
+  b.addState("p");
+  b.addEvent("t");
+  b.addLinkFromEventToState(0, 1);
+  BOOST_CHECK_THROW((void)b.build(), std::invalid_argument);
+  b = des::AutomationBuilder();
+  b.addState("p");
+  b.addEvent("t");
+  b.addLinkFromStateToEvent(0, 0, UINT_MAX);
+  b.addLinkFromStateToEvent(0, 0, 1);
+  BOOST_CHECK_THROW((void)b.build(), std::invalid_argument);
+  b = des::AutomationBuilder();
+  des::Event m(des::EventType::macro);
+  m.addMaskedEvent("absent");
+  b.addEvent("macro", m);
+  BOOST_CHECK_THROW((void)b.build(), std::runtime_error);
+}
+
+// Test of equivalence with step-by-step construction.
+BOOST_AUTO_TEST_CASE(BuildLargeAutomation) {
+  const size_t n = 2000;
+  des::AutomationBuilder b;
+  des::Automation expected;
+  b.reserve(n, n, 2 * n);
+  for (size_t k = 0; k < n; k++) {
+    const std::string s = "p" + std::to_string(k), e = "t" + std::to_string(k);
+    b.addState(s, k % 3);
+    b.addEvent(e);
+    expected.addState(s, k % 3);
+    expected.addEvent(e, des::EventType::controllable);
+  }
+  for (size_t k = 0; k < n; k++) {
+    const size_t next = (k * 7 + 1) % n;
+    b.addLinkFromStateToEvent(k, k, 1 + k % 2);
+    b.addLinkFromEventToState(k, next);
+    expected.setLinkFromStateToEvent("p" + std::to_string(k), "t" + std::to_string(k), 1 + k % 2);
+    expected.setLinkFromEventToState("t" + std::to_string(k), "p" + std::to_string(next));
+  }
+  std::pmr::monotonic_buffer_resource arena;
+  const des::Automation a = b.build(&arena);
+  BOOST_CHECK(a.resource() == &arena);
+  BOOST_CHECK(a.getStateNameSet() == expected.getStateNameSet());
+  BOOST_CHECK(a.getEventNameSet() == expected.getEventNameSet());
+  BOOST_CHECK(a.getReadyEvents() == expected.getReadyEvents());
+  for (const auto& s : expected.getStateNameSet()) {
+    BOOST_CHECK(a.getActivity(s) == expected.getActivity(s));
+    BOOST_CHECK(a.getStateInputs(s) == expected.getStateInputs(s));
+    BOOST_CHECK(a.getStateOutputs(s) == expected.getStateOutputs(s));
+    for (const auto& e : a.getStateOutputs(s)) {
+      BOOST_CHECK(a.getLinksFromStateToEvent(s, e) == expected.getLinksFromStateToEvent(s, e));
+    }
+  }
+}
@@ -3,6 +3,9 @@
 @authors A. Kozov
 @date 2021/12/21 */
 
+#include <memory_resource>
+#include <vector>
+
 #include <boost/test/unit_test.hpp>
 
 #include "automation.hpp"
@@ -459,3 +462,136 @@ BOOST_AUTO_TEST_CASE(AutomationFire) {
   BOOST_CHECK(a.getState(state_name_1).activity() == 0);
   BOOST_CHECK(a.getState(state_name_2).activity() == 0);
 }
+
+namespace {
+
+  // Memory resource counting allocations of upstream resource.
+  class CountingResource : public std::pmr::memory_resource {
+  public:
+    size_t Allocations = 0;
+    size_t Bytes = 0;
+
+  private:
+    void* do_allocate(size_t b, size_t a) override {
+      Allocations++;
+      Bytes += b;
+      return std::pmr::new_delete_resource()->allocate(b, a);
+    }
+    void do_deallocate(void* p, size_t b, size_t a) override {
+      Bytes -= b;
+      std::pmr::new_delete_resource()->deallocate(p, b, a);
+    }
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& o) const noexcept override {
+      return this == &o;
+    }
+  };
+
+} // namespace
+
+// Test of Automation placed into memory resource.
+BOOST_AUTO_TEST_CASE(AutomationMemoryResource) {
+  CountingResource counting;
+  {
+    des::Automation a(&counting);
+    BOOST_CHECK(a.resource() == &counting);
+    a.addState("s1", 1);
+    a.addState("s2");
+    a.addEvent("e1", des::EventType::controllable);
+    a.linkStatesByEvent("s1", "e1", "s2");
+    const size_t allocations = counting.Allocations;
+    BOOST_CHECK(allocations >= 7); // at least nodes of two states, event and four links
+    a.fire();
+    BOOST_CHECK(a.getActivity("s2") == 1);
+    BOOST_CHECK(counting.Allocations == allocations);
+    const des::Automation copy(a); // copies share data
+    BOOST_CHECK(copy.resource() == &counting);
+    BOOST_CHECK(counting.Allocations == allocations);
+    des::Automation placed(copy, std::pmr::new_delete_resource());
+    BOOST_CHECK(placed.resource() == std::pmr::new_delete_resource());
+    BOOST_CHECK(placed.getLinksFromEventToState("e1", "s2") == 1);
+    placed.setActivity("s1", 5);
+    BOOST_CHECK(counting.Allocations == allocations);
+    BOOST_CHECK(copy.getActivity("s1") == 0);
+    const des::Automation moved(std::move(a));
+    BOOST_CHECK(moved.resource() == &counting);
+  }
+  BOOST_CHECK(counting.Bytes == 0);
+  // whole net in one arena
+  std::pmr::monotonic_buffer_resource arena(&counting);
+  des::Automation a(&arena);
+  for (int k = 0; k < 1000; k++) {
+    a.addState("s" + std::to_string(k), 1);
+    a.addEvent("e" + std::to_string(k), des::EventType::controllable);
+    a.setLinkFromStateToEvent("s" + std::to_string(k), "e" + std::to_string(k));
+  }
+  BOOST_CHECK(a.getReadyEvents().size() == 1000);
+  BOOST_CHECK(counting.Allocations < 100); // large chunks instead of 4000 nodes
+}
+
+// Test of Automation snapshots sharing unchanged states and events.
+BOOST_AUTO_TEST_CASE(AutomationSnapshot) {
+  CountingResource counting;
+  des::Automation a(&counting);
+  const int n = 10000;
+  for (int k = 0; k < n; k++) {
+    a.addState("s" + std::to_string(k), k % 2);
+    a.addEvent("e" + std::to_string(k), des::EventType::controllable);
+  }
+  for (int k = 0; k < n; k++) {
+    a.setLinkFromStateToEvent("s" + std::to_string(k), "e" + std::to_string(k));
+    a.setLinkFromEventToState("e" + std::to_string(k), "s" + std::to_string((k + 1) % n));
+  }
+  const size_t bytes = counting.Bytes;
+  std::vector<des::Automation> variants;
+  for (int k = 0; k < 100; k++) {
+    variants.push_back(a.snapshot());
+    auto& v = variants.back();
+    v.setActivity("s" + std::to_string(k), 7);
+    v.setLinkFromStateToEvent("s" + std::to_string(k), "e" + std::to_string(k), 3);
+    v.removeEvent("e" + std::to_string(n - 1 - k));
+  }
+  // each variant copies a few states, events and leaves, and the roots
+  BOOST_CHECK((counting.Bytes - bytes) / variants.size() < bytes / 10);
+  for (int k = 0; k < 100; k++) {
+    const auto& v = variants[k];
+    BOOST_CHECK(v.getActivity("s" + std::to_string(k)) == 7);
+    BOOST_CHECK(v.getLinksFromStateToEvent("s" + std::to_string(k), "e" + std::to_string(k)) == 3);
+    BOOST_CHECK(!v.checkEvent("e" + std::to_string(n - 1 - k)));
+    BOOST_CHECK(v.getEventQuantity() == n - 1);
+    BOOST_CHECK(v.getActivity("s" + std::to_string(k + 1)) == static_cast<unsigned>((k + 1) % 2));
+  }
+  BOOST_CHECK(a.getEventQuantity() == n);
+  for (int k = 0; k < 100; k++) {
+    BOOST_CHECK(a.getActivity("s" + std::to_string(k)) == static_cast<unsigned>(k % 2));
+    BOOST_CHECK(a.getLinksFromStateToEvent("s" + std::to_string(k), "e" + std::to_string(k)) == 1);
+    BOOST_CHECK(a.getStateInputs("s" + std::to_string((n - k) % n)) ==
+      std::set<std::string>{ "e" + std::to_string(n - 1 - k) });
+  }
+  variants.clear();
+  BOOST_CHECK(counting.Bytes == bytes);
+}
+
+// Test of copies and snapshots made after getting of references to states and events.
+BOOST_AUTO_TEST_CASE(AutomationCopyDetachesReferences) {
+  des::Automation a;
+  a.addState("p", 1);
+  a.addEvent("t", des::EventType::controllable);
+  des::State& state = a.getState("p");
+  des::Event& event = a.getEvent("t");
+  const des::Automation snap = a.snapshot();
+  const des::Automation c(a);
+  CountingResource counting;
+  const des::Automation arena(a, &counting);
+  state.setActivity(7);
+  event = des::Event(des::EventType::uncontrollable);
+  BOOST_CHECK(a.getActivity("p") == 7 && a.getType("t") == des::EventType::uncontrollable);
+  for (const des::Automation* x : { &snap, &c, &arena }) {
+    BOOST_CHECK(x->getActivity("p") == 1 && x->getType("t") == des::EventType::controllable);
+    BOOST_CHECK(x->fingerprint() == snap.fingerprint());
+  }
+  BOOST_CHECK(a.fingerprint() != snap.fingerprint());
+  des::Automation d(snap); // the copy is fingerprinted incrementally again
+  d.setActivity("p", 7);
+  d.addEvent("t", des::Event(des::EventType::uncontrollable));
+  BOOST_CHECK(d.fingerprint() == a.fingerprint());
+}
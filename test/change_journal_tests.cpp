@@ -0,0 +1,102 @@
+/*! @file change_journal_tests.cpp
+@ref des::ChangeJournal class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "automation.hpp"
+
+
+// Test of changes since version and commit boundaries.
+BOOST_AUTO_TEST_CASE(ChangeJournalVersions) {
+  des::Automation a;
+  a.addState("p", 1);
+  BOOST_CHECK(!a.getChangesSince(0));
+  a.enableChangeLog();
+  BOOST_CHECK(!a.getChangesSince(0)); // changes before enabling aren't known
+  BOOST_CHECK(a.getChangesSince(1)->empty());
+  a.addState("q");
+  a.addEvent("t", des::EventType::controllable);
+  BOOST_CHECK(a.commitChanges() == 3 && a.getCommittedVersion() == 3);
+  a.linkStatesByEvent("p", "t", "q");
+  a.setActivity("q", 2);
+  a.commitChanges();
+  a.setActivity("p", 0);
+  const auto changes = a.getChangesSince(1);
+  BOOST_REQUIRE(changes && changes->size() == 6);
+  BOOST_CHECK(changes->at(0).Kind == des::ChangeKind::addState && changes->at(0).State == "q");
+  BOOST_CHECK(changes->at(0).Version == 2 && !changes->at(0).Commit);
+  BOOST_CHECK(changes->at(1).Event == "t" && changes->at(1).Commit);
+  BOOST_CHECK(changes->at(2).State == "p" && changes->at(2).Event == "t" && changes->at(2).Value == 1);
+  BOOST_CHECK(changes->at(3).Kind == des::ChangeKind::setOutputLink && !changes->at(3).Commit);
+  BOOST_CHECK(changes->at(4).Version == 6 && changes->at(4).Commit);
+  BOOST_CHECK(changes->at(5).Value == 0 && !changes->at(5).Commit);
+  BOOST_CHECK(a.getChangesSince(4)->size() == 3);
+  BOOST_CHECK(!a.getChangesSince(8)); // the future version
+  BOOST_CHECK(a.getChangesSince(7)->empty());
+  a.setActivity("q", 3);
+  BOOST_CHECK(!a.getChangesSince(4)->back().Commit); // the batch isn't closed
+
+  des::Automation copy = a.snapshot();
+  copy.addState("r");
+  a.addState("s");
+  BOOST_CHECK(copy.getChangesSince(8)->front().State == "r");
+  BOOST_CHECK(a.getChangesSince(8)->front().State == "s");
+  BOOST_CHECK(a.getChangesSince(1)->size() == 8);
+}
+
+// Test of flags of changed parts.
+BOOST_AUTO_TEST_CASE(ChangeJournalDirtyFlags) {
+  des::Automation a;
+  a.enableChangeLog();
+  a.addState("p");
+  a.addEvent("t", des::EventType::controllable);
+  const uint64_t structure = a.commitChanges();
+  a.setLinkFromStateToEvent("p", "t");
+  const uint64_t links = a.commitChanges();
+  a.setActivity("p", 4);
+  BOOST_CHECK(*a.getDirtySince(0) == (des::dirtyStates | des::dirtyEvents | des::dirtyLinks | des::dirtyMarking));
+  BOOST_CHECK(*a.getDirtySince(structure) == (des::dirtyLinks | des::dirtyMarking));
+  BOOST_CHECK(*a.getDirtySince(links) == des::dirtyMarking);
+  BOOST_CHECK(*a.getDirtySince(a.version()) == 0);
+  a.getEvent("t") = des::Event(des::EventType::uncontrollable);
+  BOOST_CHECK(*a.getDirtySince(links + 1) == des::dirtyTypes);
+  BOOST_CHECK(!a.getDirtySince(a.version() + 1));
+
+  des::Automation long_log;
+  long_log.enableChangeLog();
+  long_log.addState("p");
+  long_log.addEvent("t", des::EventType::controllable);
+  for (unsigned k = 0; k < 10000; k++) { // several chunks
+    long_log.setActivity("p", k);
+  }
+  long_log.setLinkFromEventToState("t", "p");
+  BOOST_CHECK(*long_log.getDirtySince(5000) == (des::dirtyMarking | des::dirtyLinks));
+  BOOST_CHECK(*long_log.getDirtySince(0) == (des::dirtyStates | des::dirtyEvents | des::dirtyLinks |
+    des::dirtyMarking));
+  const auto changes = long_log.getChangesSince(4000);
+  BOOST_REQUIRE(changes && changes->size() == 6003);
+  BOOST_CHECK(changes->front().Value == 3998 && changes->front().Version == 4001);
+  BOOST_CHECK(changes->back().Kind == des::ChangeKind::setOutputLink);
+}
+
+// Test of compact records.
+BOOST_AUTO_TEST_CASE(ChangeJournalMemory) {
+  des::ChangeJournal j;
+  BOOST_CHECK(!j.enabled() && !j.firstVersion() && j.memory() == 0);
+  j.record(des::ChangeKind::addState, "p", "", 0);
+  j.enable();
+  BOOST_CHECK(*j.firstVersion() == 1);
+  for (unsigned k = 0; k < 100000; k++) {
+    j.record(des::ChangeKind::setInputLink, "state", "event", k);
+  }
+  BOOST_CHECK(j.memory() < 100000 * 32); // records take 12 bytes and names take 10 bytes
+  const des::ChangeJournal copy = j;
+  j.record(des::ChangeKind::removeState, "state", "", 0);
+  BOOST_CHECK(copy.version() == 100001 && j.version() == 100002);
+  BOOST_CHECK(j.changesSince(copy)->size() == 1);
+  BOOST_CHECK(!copy.changesSince(j));
+  j.disable();
+  BOOST_CHECK(!j.changesSince(copy) && j.version() == 100002);
+}
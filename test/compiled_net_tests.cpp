@@ -0,0 +1,88 @@
+/*! @file compiled_net_tests.cpp
+@ref des::CompiledNet class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "compiled_net.hpp"
+
+
+// Test of CompiledNet constructor.
+BOOST_AUTO_TEST_CASE(CreateCompiledNet) {
+  des::Automation a;
+  a.addState("Wait", 1);
+  a.addState("Move");
+  a.addEvent("start", des::EventType::controllable);
+  a.addEvent("success", des::EventType::expected);
+  a.setLinkFromStateToEvent("Wait", "start", 1);
+  a.setLinkFromEventToState("start", "Move", 2);
+  a.setLinkFromStateToEvent("Move", "success", 2);
+  a.setLinkFromEventToState("success", "Wait");
+  const des::CompiledNet n(a);
+  BOOST_CHECK(n.getStateQuantity() == 2);
+  BOOST_CHECK(n.getEventQuantity() == 2);
+  BOOST_CHECK(n.getStateName(0) == "Move"); // ordered by names
+  BOOST_CHECK(n.getStateName(1) == "Wait");
+  BOOST_CHECK(n.getEventName(0) == "start");
+  BOOST_CHECK(n.getType(1) == des::EventType::expected);
+  BOOST_CHECK_THROW(auto r = n.getStateName(2), std::out_of_range);
+  BOOST_CHECK((n.getInitialMarking() == des::Marking{ 0, 1 }));
+  BOOST_CHECK(n.getEventInputs(0).size() == 1);
+  BOOST_CHECK(n.getEventInputs(0).begin()->Index == 1);
+  BOOST_CHECK(n.getEventOutputs(0).begin()->Multiplicity == 2);
+}
+
+// Test of CompiledNet isReady and fire methods.
+BOOST_AUTO_TEST_CASE(CompiledNetFire) {
+  des::Automation a;
+  a.addState("p1", 1);
+  a.addState("p2");
+  a.addEvent("t1", des::EventType::controllable);
+  a.addEvent("t2", des::EventType::controllable);
+  a.addEvent("t3", des::EventType::controllable);
+  a.setLinkFromStateToEvent("p1", "t1");
+  a.setLinkFromEventToState("t1", "p2", 3);
+  a.setLinkFromStateToEvent("p2", "t2", 2);
+  a.setLinkFromEventToState("t3", "p1"); // event without input links
+  const des::CompiledNet n(a);
+  des::Marking m = n.getInitialMarking(), r;
+  BOOST_CHECK(n.isReady(m, 0));
+  BOOST_CHECK(!n.isReady(m, 1));
+  BOOST_CHECK(!n.isReady(m, 2));
+  n.fire(m, 0, r);
+  BOOST_CHECK((r == des::Marking{ 0, 3 }));
+  BOOST_CHECK(n.isReady(r, 1));
+  n.fire(r, 1, m);
+  BOOST_CHECK((m == des::Marking{ 0, 1 }));
+  m = { des::omega, 0 }; // unbounded state satisfies input links and keeps omega
+  BOOST_CHECK(n.isReady(m, 0));
+  n.fire(m, 0, r);
+  BOOST_CHECK((r == des::Marking{ des::omega, 3 }));
+  m = { 1, des::omega - 2 };
+  n.fire(m, 0, r);
+  BOOST_CHECK((r == des::Marking{ 0, des::omega - 1 })); // saturation
+}
+
+// Test of CompiledNet links indexed by states and unsatisfied input links.
+BOOST_AUTO_TEST_CASE(CompiledNetConsumers) {
+  des::Automation a;
+  a.addState("p1", 1);
+  a.addState("p2");
+  a.addEvent("t1", des::EventType::controllable);
+  a.addEvent("t2", des::EventType::controllable);
+  a.addEvent("t3", des::EventType::controllable);
+  a.setLinkFromStateToEvent("p1", "t1");
+  a.setLinkFromStateToEvent("p1", "t2");
+  a.setLinkFromStateToEvent("p2", "t2", 2);
+  a.setLinkFromEventToState("t3", "p1"); // event without input links
+  const des::CompiledNet n(a);
+  const auto consumers = n.getStateConsumers(0);
+  BOOST_REQUIRE(consumers.size() == 2);
+  BOOST_CHECK(consumers.begin()[0].Index == 0 && consumers.begin()[1].Index == 1);
+  BOOST_CHECK(n.getStateConsumers(1).size() == 1 && n.getStateConsumers(1).begin()->Multiplicity == 2);
+  const des::Marking m = n.getInitialMarking();
+  BOOST_CHECK(n.getMissingInputs(m, 0) == 0 && n.getMissingInputs(m, 1) == 1);
+  BOOST_CHECK(n.getMissingInputs(m, 2) == 1); // the event is never ready
+  BOOST_CHECK(n.getMissingInputs({ 0, 1 }, 1) == 2);
+}
@@ -6,6 +6,8 @@ DES components tests source file.
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE ModelTests
 
+#include <regex>
+
 #include <boost/test/unit_test.hpp>
 
 #include "components.hpp"
@@ -96,3 +98,35 @@ BOOST_AUTO_TEST_CASE(CheckNameString) {
   const std::string right("Test/Name_123");
   BOOST_CHECK(des::checkNameString(right));
 }
+
+// Test of equivalence of checkNameString function and regular expression of names.
+BOOST_AUTO_TEST_CASE(CheckNameStringByRegex) {
+  const std::regex r("[[:alpha:]][[:alpha:][:digit:]_/]*");
+  auto expected = [&r](const std::string& s) { return s.length() < des::max_name_length && std::regex_match(s, r); };
+  // all strings of one and two characters
+  BOOST_CHECK(des::checkNameString("") == expected(""));
+  for (int f = 0; f < 256; f++) {
+    std::string s(1, static_cast<char>(f));
+    BOOST_CHECK(des::checkNameString(s) == expected(s));
+    s.push_back(' ');
+    for (int c = 0; c < 256; c++) {
+      s[1] = static_cast<char>(c);
+      if (des::checkNameString(s) != expected(s)) {
+        BOOST_ERROR("different results for characters " << f << " and " << c);
+      }
+    }
+  }
+  // every character at every position of names with lengths around the limit
+  for (const size_t n : { size_t(3), size_t(8), size_t(17), des::max_name_length - 1, des::max_name_length }) {
+    std::string s(n, 'a');
+    for (size_t k = 0; k < n; k++) {
+      for (int c = 0; c < 256; c++) {
+        s[k] = static_cast<char>(c);
+        if (des::checkNameString(s) != expected(s)) {
+          BOOST_ERROR("different results for character " << c << " at " << k << " of " << n);
+        }
+      }
+      s[k] = 'a';
+    }
+  }
+}
@@ -175,3 +175,19 @@ BOOST_AUTO_TEST_CASE(CompareEvents) {
   other_event.setMappingRules(event.getMappingRules());
   BOOST_CHECK(event == other_event);
 }
+
+// Test of Event layout with metadata in cold storage.
+BOOST_AUTO_TEST_CASE(EventColdStorage) {
+  BOOST_CHECK(sizeof(des::Event) <= 2 * sizeof(void*));
+  const des::Event macro(des::EventType::macro);
+  BOOST_CHECK(macro.getMaskedEvents().empty());
+  BOOST_CHECK(macro.getMappingRules().empty());
+  des::Event touched(des::EventType::macro);
+  (void)touched.behaviorAttributes(); // default metadata is allocated
+  BOOST_CHECK(macro == touched);
+  touched.addMaskedEvent("TestEvent");
+  des::Event copy = touched;
+  touched.addMaskedEvent("OtherEvent"); // copies are deep
+  BOOST_CHECK(copy.getMaskedEvents().size() == 1);
+  BOOST_CHECK(!(copy == touched));
+}
@@ -0,0 +1,90 @@
+/*! @file external_bfs_tests.cpp
+@ref des::ExternalExplorer class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "external_bfs.hpp"
+
+
+// Test of exploration of cyclic net.
+BOOST_AUTO_TEST_CASE(ExternalExplorerCycle) {
+  des::Automation a;
+  for (unsigned i = 1; i <= 5; i++) {
+    a.addState("p" + std::to_string(i), i == 1 ? 1 : 0);
+    a.addEvent("t" + std::to_string(i), des::EventType::controllable);
+  }
+  for (unsigned i = 1; i <= 5; i++) {
+    a.linkStatesByEvent("p" + std::to_string(i), "t" + std::to_string(i), "p" + std::to_string(i % 5 + 1));
+  }
+  const des::CompiledNet n(a);
+  const auto r = des::ExternalExplorer(n).run();
+  BOOST_CHECK(r.Complete);
+  BOOST_CHECK(r.States == 5);
+  BOOST_CHECK(r.Transitions == 5);
+  BOOST_CHECK(r.Layers == 4);
+  BOOST_CHECK(r.Deadlocks == 0);
+  BOOST_CHECK((r.Bounds == des::Marking{ 1, 1, 1, 1, 1 }));
+}
+
+// Test of exploration with memory budget less than reachability set.
+BOOST_AUTO_TEST_CASE(ExternalExplorerSmallBudget) {
+  des::Automation a;
+  const unsigned pairs = 8;
+  for (unsigned i = 0; i < pairs; i++) {
+    const std::string s = std::to_string(i);
+    a.addState("p" + s, 1);
+    a.addState("q" + s);
+    a.addEvent("on" + s, des::EventType::controllable);
+    a.addEvent("off" + s, des::EventType::controllable);
+    a.linkStatesByEvent("p" + s, "on" + s, "q" + s);
+    a.linkStatesByEvent("q" + s, "off" + s, "p" + s);
+  }
+  const des::CompiledNet n(a);
+  des::ExternalExplorerOptions o;
+  o.MemoryBudget = 1; // minimal buffers
+  size_t reports = 0, last_states = 0;
+  o.Progress = [&](const des::AnalysisProgress& p) { reports++; last_states = p.States; };
+  const auto r = des::ExternalExplorer(n, o).run();
+  BOOST_CHECK(reports == 1); // only final report for short exploration
+  BOOST_CHECK(last_states == r.States);
+  BOOST_CHECK(r.Complete);
+  BOOST_CHECK(r.States == 1u << pairs);
+  BOOST_CHECK(r.Transitions == pairs * (1u << pairs));
+  BOOST_CHECK(r.Layers == pairs);
+  BOOST_CHECK(r.Deadlocks == 0);
+  BOOST_CHECK(r.Runs > pairs);
+}
+
+// Test of exploration limits and deadlocks.
+BOOST_AUTO_TEST_CASE(ExternalExplorerLimits) {
+  des::Automation a;
+  a.addState("p1", 1);
+  a.addState("p2");
+  a.addState("p3");
+  a.addEvent("t1", des::EventType::controllable);
+  a.addEvent("t2", des::EventType::controllable);
+  a.setLinkFromStateToEvent("p1", "t1");
+  a.setLinkFromEventToState("t1", "p1");
+  a.setLinkFromEventToState("t1", "p2"); // unbounded state
+  a.setLinkFromStateToEvent("p1", "t2");
+  a.setLinkFromEventToState("t2", "p3");
+  const des::CompiledNet n(a);
+  des::ExternalExplorerOptions o;
+  o.TokenBound = 10;
+  auto r = des::ExternalExplorer(n, o).run();
+  BOOST_CHECK(!r.Complete);
+  BOOST_CHECK(r.Deadlocks == 10);
+  o.TokenBound = des::omega - 1;
+  o.MaxStates = 100;
+  r = des::ExternalExplorer(n, o).run();
+  BOOST_CHECK(!r.Complete);
+  BOOST_CHECK(r.States >= 100);
+  a.removeEvent("t1");
+  const des::CompiledNet bounded(a);
+  r = des::ExternalExplorer(bounded, o).run();
+  BOOST_CHECK(r.Complete);
+  BOOST_CHECK(r.States == 2);
+  BOOST_CHECK(r.Deadlocks == 1);
+}
@@ -0,0 +1,148 @@
+/*! @file fingerprint_tests.cpp
+@ref des::Fingerprint structure tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <set>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "automation_builder.hpp"
+
+
+namespace {
+
+  // Net with two states and two events in specified order of changes.
+  des::Automation makeNet(bool reversed) {
+    des::Automation a;
+    if (reversed) {
+      a.addEvent("t2", des::EventType::uncontrollable);
+      a.addEvent("t1", des::EventType::controllable);
+      a.addState("p2");
+      a.addState("p1", 1);
+      a.setLinkFromEventToState("t2", "p1");
+      a.setLinkFromStateToEvent("p2", "t2");
+      a.setLinkFromEventToState("t1", "p2", 2);
+      a.setLinkFromStateToEvent("p1", "t1");
+    }
+    else {
+      a.addState("p1", 1);
+      a.addState("p2");
+      a.addEvent("t1", des::EventType::controllable);
+      a.addEvent("t2", des::EventType::uncontrollable);
+      a.setLinkFromStateToEvent("p1", "t1");
+      a.setLinkFromEventToState("t1", "p2", 2);
+      a.setLinkFromStateToEvent("p2", "t2");
+      a.setLinkFromEventToState("t2", "p1");
+    }
+    return a;
+  }
+
+} // namespace
+
+// Test of independence from order of changes and from way of construction.
+BOOST_AUTO_TEST_CASE(FingerprintEquality) {
+  const des::Automation a = makeNet(false), b = makeNet(true);
+  BOOST_CHECK(des::Automation().fingerprint() == des::Fingerprint());
+  BOOST_CHECK(a.fingerprint() != des::Fingerprint());
+  BOOST_CHECK(a.fingerprint() == b.fingerprint());
+  BOOST_CHECK(a.fingerprint().toString().size() == 32);
+  des::AutomationBuilder builder;
+  builder.addEvent("t2", des::EventType::uncontrollable);
+  builder.addState("p2");
+  builder.addState("p1", 1);
+  builder.addEvent("t1");
+  builder.addLinkFromStateToEvent("p1", "t1");
+  builder.addLinkFromEventToState("t1", "p2");
+  builder.addLinkFromEventToState("t1", "p2"); // parallel links are merged
+  builder.addLinkFromStateToEvent("p2", "t2");
+  builder.addLinkFromEventToState("t2", "p1");
+  BOOST_CHECK(builder.build().fingerprint() == a.fingerprint());
+  BOOST_CHECK(des::Automation(a, std::pmr::get_default_resource()).fingerprint() == a.fingerprint());
+}
+
+// Test of sensitivity to marking, types, multiplicities, directions and names.
+BOOST_AUTO_TEST_CASE(FingerprintDifference) {
+  const des::Fingerprint f = makeNet(false).fingerprint();
+  des::Automation a = makeNet(false);
+  a.setActivity("p1", 2);
+  BOOST_CHECK(a.fingerprint() != f);
+  a.setActivity("p1", 1);
+  BOOST_CHECK(a.fingerprint() == f);
+  a.addEvent("t2", des::Event(des::EventType::controllable));
+  BOOST_CHECK(a.fingerprint() != f);
+  a.addEvent("t2", des::Event(des::EventType::uncontrollable));
+  BOOST_CHECK(a.fingerprint() == f);
+  a.setLinkFromEventToState("t1", "p2", 3);
+  BOOST_CHECK(a.fingerprint() != f);
+  a.setLinkFromEventToState("t1", "p2", 0);
+  a.setLinkFromStateToEvent("p2", "t1", 2);
+  BOOST_CHECK(a.fingerprint() != f);
+  a.setLinkFromStateToEvent("p2", "t1", 0);
+  a.setLinkFromEventToState("t1", "p2", 2);
+  BOOST_CHECK(a.fingerprint() == f);
+  a.addState("p3");
+  BOOST_CHECK(a.fingerprint() != f);
+  a.removeState("p3");
+  BOOST_CHECK(a.fingerprint() == f);
+  a.removeEvent("t1");
+  a.addEvent("t1", des::EventType::controllable);
+  BOOST_CHECK(a.fingerprint() != f);
+  a.linkStatesByEvent("p1", "t1", "p2");
+  a.setLinkFromEventToState("t1", "p2", 2);
+  BOOST_CHECK(a.fingerprint() == f);
+  a.fire("t1");
+  BOOST_CHECK(a.fingerprint() != f);
+  a.fire("t2");
+  BOOST_CHECK(a.fingerprint() != f);
+  a.setActivity("p1", 1);
+  a.setActivity("p2", 0);
+  BOOST_CHECK(a.fingerprint() == f);
+}
+
+// Test of changes through references.
+BOOST_AUTO_TEST_CASE(FingerprintOfReferences) {
+  const des::Fingerprint f = makeNet(false).fingerprint();
+  des::Automation a = makeNet(false);
+  des::State& s = a.getState("p2");
+  des::Event& e = a.getEvent("t1");
+  BOOST_CHECK(a.fingerprint() == f);
+  s.setActivity(4);
+  BOOST_CHECK(a.fingerprint() != f);
+  s.setActivity(0);
+  e = des::Event(des::EventType::uncontrollable);
+  BOOST_CHECK(a.fingerprint() != f);
+  e = des::Event(des::EventType::controllable);
+  a.setActivity("p2", 0);
+  BOOST_CHECK(a.fingerprint() == f);
+  const des::Automation copy = a.snapshot();
+  a.removeState("p2");
+  a.removeEvent("t1");
+  BOOST_CHECK(copy.fingerprint() == f);
+  a.addState("p2");
+  a.addEvent("t1", des::EventType::controllable);
+  a.setLinkFromStateToEvent("p1", "t1");
+  a.setLinkFromEventToState("t1", "p2", 2);
+  a.setLinkFromStateToEvent("p2", "t2");
+  BOOST_CHECK(a.fingerprint() == f);
+}
+
+// Test of independence of fingerprint halves.
+BOOST_AUTO_TEST_CASE(FingerprintHalves) {
+  std::set<uint64_t> highs, lows, relations;
+  size_t equal_bits = 0;
+  const unsigned n = 1000;
+  for (unsigned k = 0; k < n; k++) {
+    const des::Fingerprint f = des::fingerprintState("p" + std::to_string(k), k % 3);
+    BOOST_CHECK(f.High != f.Low);
+    highs.insert(f.High);
+    lows.insert(f.Low);
+    relations.insert(f.High ^ f.Low);
+    for (int b = 0; b < 64; b++) {
+      equal_bits += ((f.High ^ f.Low) >> b & 1) == 0;
+    }
+  }
+  BOOST_CHECK(highs.size() == n && lows.size() == n && relations.size() == n);
+  BOOST_CHECK(equal_bits > 64 * n * 48 / 100 && equal_bits < 64 * n * 52 / 100); // bits of halves agree by chance
+}
@@ -0,0 +1,132 @@
+/*! @file graph_binary_tests.cpp
+Binary format of reachability graphs and @ref des::MappedGraph class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <sstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include "graph_binary.hpp"
+#include "test_nets.hpp"
+
+
+namespace {
+
+  // Binary image of reachability graph in aligned memory.
+  std::vector<uint64_t> makeImage(const des::CompiledNet& n, const des::BinaryGraphOptions& o = {}) {
+    std::ostringstream s;
+    des::writeBinaryGraph(s, n, o);
+    const std::string d = s.str();
+    std::vector<uint64_t> result(d.size() / sizeof(uint64_t));
+    BOOST_REQUIRE(d.size() % sizeof(uint64_t) == 0);
+    std::memcpy(result.data(), d.data(), d.size());
+    return result;
+  }
+
+  // Checks markings and edges of the graph by firing of events.
+  void checkGraph(const des::CompiledNet& n, const des::MappedGraph& g) {
+    std::set<des::Marking> markings;
+    des::Marking m, target, fired(n.getStateQuantity());
+    std::vector<des::GraphEdge> edges;
+    size_t quantity = 0;
+    for (size_t i = 0; i < g.getNodeQuantity(); i++) {
+      g.getMarking(i, m);
+      markings.insert(m);
+      g.getEdges(i, edges);
+      quantity += edges.size();
+      for (const auto& e : edges) {
+        BOOST_REQUIRE(n.isReady(m, e.Event));
+        n.fire(m, e.Event, fired);
+        g.getMarking(e.Target, target);
+        BOOST_CHECK(fired == target);
+      }
+      if (i) {
+        g.getMarking(g.getParent(i), target);
+        BOOST_CHECK(target != m);
+      }
+    }
+    BOOST_CHECK(markings.size() == g.getNodeQuantity());
+    BOOST_CHECK(quantity == g.getEdgeQuantity());
+  }
+
+} // namespace
+
+// Test of graph written and read in memory.
+BOOST_AUTO_TEST_CASE(BinaryGraphView) {
+  const des::CompiledNet n(makeRing(6, 5));
+  const auto image = makeImage(n);
+  const des::MappedGraph g(image.data(), image.size() * sizeof(uint64_t));
+  const auto& h = g.getHeader();
+  BOOST_CHECK(h.Nodes == 252 && h.Complete == 1 && h.Deadlocks == 0); // 5 tokens in 6 states
+  BOOST_CHECK(h.MaxTokens == 5 && h.States == 6 && h.Events == 6);
+  BOOST_CHECK(g.getStateName(2) == "p2" && g.getEventName(5) == "t5");
+  des::Marking m;
+  g.getMarking(0, m);
+  BOOST_CHECK(m == n.getInitialMarking());
+  BOOST_CHECK(g.getParent(0) == des::MappedGraph::none);
+  checkGraph(n, g);
+  BOOST_CHECK(h.EdgeBytes + h.MarkingBytes < 10 * h.Edges); // a few bytes per edge and per changed state
+
+  const des::CompiledNet chain(makeRing(40, 1)); // long paths have full marking records
+  const auto chain_image = makeImage(chain);
+  const des::MappedGraph c(chain_image.data(), chain_image.size() * sizeof(uint64_t));
+  BOOST_CHECK(c.getHeader().Nodes == 40 && c.getHeader().Depth == 39);
+  checkGraph(chain, c);
+  BOOST_CHECK_THROW(c.getMarking(40, m), std::out_of_range);
+}
+
+// Test of limits, files and damaged data.
+BOOST_AUTO_TEST_CASE(BinaryGraphFile) {
+  const des::CompiledNet n(makeRing(6, 5));
+  des::BinaryGraphOptions o;
+  o.MaxStates = 100;
+  const std::string path = "des-binary-graph-test.bin";
+  const auto written = des::writeBinaryGraphFile(path, n, o);
+  {
+    const des::MappedGraph g(path);
+    BOOST_CHECK(g.getHeader().Nodes == 100 && g.getHeader().Complete == 0);
+    BOOST_CHECK(g.getHeader().Edges == written.Edges);
+    checkGraph(n, g);
+  }
+  std::remove(path.c_str());
+
+  des::Automation deadlock;
+  deadlock.addState("p", 1);
+  deadlock.addState("q");
+  deadlock.addEvent("t", des::EventType::controllable);
+  deadlock.linkStatesByEvent("p", "t", "q");
+  const des::CompiledNet d(deadlock);
+  auto image = makeImage(d);
+  const des::MappedGraph g(image.data(), image.size() * sizeof(uint64_t));
+  BOOST_CHECK(g.getHeader().Nodes == 2 && g.getHeader().Deadlocks == 1 && g.getHeader().Edges == 1);
+
+  auto damaged = makeImage(n);
+  auto* h = reinterpret_cast<des::BinaryGraphHeader*>(damaged.data());
+  h->FileSize--;
+  BOOST_CHECK_THROW(des::MappedGraph(damaged.data(), damaged.size() * sizeof(uint64_t)), std::runtime_error);
+  h->FileSize++;
+  std::memset(reinterpret_cast<char*>(damaged.data()) + h->EdgeData, 0xff, h->EdgeBytes);
+  const des::MappedGraph broken(damaged.data(), damaged.size() * sizeof(uint64_t));
+  std::vector<des::GraphEdge> edges;
+  BOOST_CHECK_THROW(broken.getEdges(3, edges), std::runtime_error);
+  BOOST_CHECK_THROW(des::MappedGraph("des-absent-graph.bin"), std::runtime_error);
+
+  des::Automation unbounded; // exploration stops at the limit
+  unbounded.addState("p", 1);
+  unbounded.addEvent("t", des::EventType::controllable);
+  unbounded.setLinkFromStateToEvent("p", "t");
+  unbounded.setLinkFromEventToState("t", "p", 2);
+  const des::CompiledNet u(unbounded);
+  BOOST_CHECK(des::BinaryGraphOptions().MaxStates == des::default_graph_states);
+  o.MaxStates = 50;
+  image = makeImage(u, o);
+  const des::MappedGraph limited(image.data(), image.size() * sizeof(uint64_t));
+  BOOST_CHECK(limited.getHeader().Nodes == 50 && limited.getHeader().Complete == 0);
+  std::ostringstream s;
+  o.MaxStates = 0;
+  BOOST_CHECK_THROW(des::writeBinaryGraph(s, u, o), std::invalid_argument);
+}
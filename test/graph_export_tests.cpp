@@ -0,0 +1,166 @@
+/*! @file graph_export_tests.cpp
+@ref des::GraphExporter class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+
+#include <boost/test/unit_test.hpp>
+
+#include "analyse.hpp"
+#include "graph_export.hpp"
+#include "test_nets.hpp"
+
+
+namespace {
+
+  // Directory of exported files removed after test.
+  struct ExportDirectory {
+    const std::string Path = "des-graph-export-test";
+    ExportDirectory() {
+      std::filesystem::remove_all(Path);
+      std::filesystem::create_directory(Path);
+    }
+    ~ExportDirectory() {
+      std::filesystem::remove_all(Path);
+    }
+  };
+
+  // Content of file.
+  std::string read(const std::string& p) {
+    std::ifstream f(p, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+  }
+
+  // Quantity of substrings.
+  size_t count(const std::string& s, const std::string& x) {
+    size_t result = 0;
+    for (size_t p = s.find(x); p != std::string::npos; p = s.find(x, p + 1)) {
+      result++;
+    }
+    return result;
+  }
+
+} // namespace
+
+// Test of graph of analysis in all formats.
+BOOST_AUTO_TEST_CASE(GraphExportFormats) {
+  const ExportDirectory d;
+  const des::Automation a = makeRing(3);
+  des::AnalysisOptions o;
+  for (const auto format : { des::GraphFormat::dot, des::GraphFormat::graphml, des::GraphFormat::csv }) {
+    des::GraphExportOptions e;
+    e.Format = format;
+    const std::string path = d.Path + "/graph";
+    {
+      des::GraphExporter exporter(path, e);
+      o.Exporter = &exporter;
+      Analyser().run_analyse(a, o);
+      BOOST_CHECK(exporter.nodes() == 3 && exporter.edges() == 3 && !exporter.truncated());
+    }
+    const std::string text = read(path);
+    switch (format) {
+      case des::GraphFormat::dot:
+        BOOST_CHECK(text.find("digraph ReachabilityGraph {\n\tm0 [label=\"p0=1\"]\n") == 0);
+        BOOST_CHECK(text.find("\tm0 -> m1 [label=\"t0\"]\n") != std::string::npos);
+        BOOST_CHECK(text.find("\tm2 -> m0 [label=\"t2\"]\n}\n") != std::string::npos); // the edge to explored marking
+        break;
+      case des::GraphFormat::graphml:
+        BOOST_CHECK(count(text, "<node id=") == 3 && count(text, "<edge source=") == 3);
+        BOOST_CHECK(text.find("<data key=\"marking\">p1=1</data>") != std::string::npos);
+        BOOST_CHECK(text.find("</graphml>\n") == text.size() - 11);
+        break;
+      case des::GraphFormat::csv:
+        BOOST_CHECK(text == "source,target,event\n0,1,t0\n1,2,t1\n2,0,t2\n");
+        break;
+    }
+  }
+
+  des::Automation unbounded;
+  unbounded.addState("p", 1);
+  unbounded.addEvent("t", des::EventType::controllable);
+  unbounded.setLinkFromStateToEvent("p", "t");
+  unbounded.setLinkFromEventToState("t", "p", 2);
+  {
+    des::GraphExporter exporter(d.Path + "/omega.dot");
+    o.Exporter = &exporter;
+    Analyser().run_analyse(unbounded, o);
+  }
+  BOOST_CHECK(read(d.Path + "/omega.dot").find("[label=\"p=ω\"]") != std::string::npos);
+}
+
+// Test of limits, sampling and rotation of files.
+BOOST_AUTO_TEST_CASE(GraphExportLimits) {
+  const ExportDirectory d;
+  const des::Automation a = makeRing(100);
+  des::AnalysisOptions o;
+
+  des::GraphExportOptions limited;
+  limited.Format = des::GraphFormat::csv;
+  limited.MaxNodes = 10;
+  limited.MaxEdges = 5;
+  des::GraphExporter capped(d.Path + "/capped.csv", limited);
+  o.Exporter = &capped;
+  const des::AnalysisResult r = Analyser().run_analyse(a, o);
+  BOOST_CHECK(r.Statistics.States == 100); // the analysis isn't limited
+  BOOST_CHECK(capped.nodes() == 10 && capped.edges() == 5 && capped.truncated());
+  capped.close();
+  BOOST_CHECK(count(read(d.Path + "/capped.csv"), "\n") == 6);
+
+  des::GraphExportOptions sampled;
+  sampled.Sampling = 0.5;
+  sampled.Seed = 7;
+  size_t nodes[2];
+  for (auto& n : nodes) {
+    des::GraphExporter exporter(d.Path + "/sampled.dot", sampled);
+    o.Exporter = &exporter;
+    Analyser().run_analyse(a, o);
+    n = exporter.nodes();
+    BOOST_CHECK(exporter.edges() < exporter.nodes() && !exporter.truncated());
+  }
+  BOOST_CHECK(nodes[0] == nodes[1] && nodes[0] > 20 && nodes[0] < 80); // the same nodes for the same seed
+
+  des::GraphExportOptions rotated;
+  rotated.Format = des::GraphFormat::dot;
+  rotated.MaxFileSize = 1000;
+  des::GraphExporter exporter(d.Path + "/rotated.dot", rotated);
+  o.Exporter = &exporter;
+  Analyser().run_analyse(a, o);
+  exporter.close();
+  BOOST_REQUIRE(exporter.files().size() > 3);
+  BOOST_CHECK(exporter.files()[1] == d.Path + "/rotated.1.dot");
+  size_t edges = 0;
+  for (const auto& f : exporter.files()) {
+    const std::string text = read(f);
+    BOOST_CHECK(text.find("digraph ReachabilityGraph {\n") == 0 && text.find("}\n") == text.size() - 2);
+    BOOST_CHECK(text.size() < 1100);
+    edges += count(text, " -> ");
+  }
+  BOOST_CHECK(edges == 100);
+
+  rotated.Format = des::GraphFormat::graphml;
+  des::GraphExporter graphml(d.Path + "/rotated.graphml", rotated);
+  o.Exporter = &graphml;
+  Analyser().run_analyse(a, o);
+  graphml.close();
+  BOOST_REQUIRE(graphml.files().size() > 3);
+  edges = 0;
+  for (const auto& f : graphml.files()) { // each file declares ends of its edges once
+    const std::string text = read(f);
+    std::set<std::string> declared;
+    for (size_t p = text.find("<node id=\""); p != std::string::npos; p = text.find("<node id=\"", p + 1)) {
+      BOOST_CHECK(declared.insert(text.substr(p + 10, text.find('"', p + 10) - p - 10)).second);
+    }
+    for (size_t p = text.find("<edge source=\""); p != std::string::npos; p = text.find("<edge source=\"", p + 1)) {
+      const size_t source = p + 14, target = text.find("target=\"", p) + 8;
+      BOOST_CHECK(declared.count(text.substr(source, text.find('"', source) - source)) == 1);
+      BOOST_CHECK(declared.count(text.substr(target, text.find('"', target) - target)) == 1);
+      edges++;
+    }
+  }
+  BOOST_CHECK(edges == 100);
+  BOOST_CHECK_THROW(des::GraphExporter(d.Path + "/absent/graph.dot"), std::runtime_error);
+}
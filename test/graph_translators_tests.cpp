@@ -0,0 +1,53 @@
+/*! @file graph_translators_tests.cpp
+DOT translator tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <sstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include "graph_translators.hpp"
+
+
+// Test of exact DOT description with unit and multiple arcs.
+BOOST_AUTO_TEST_CASE(TranslateAutomationToDOT) {
+  des::Automation a;
+  a.addState("q");
+  a.addState("p", 1);
+  a.addEvent("c", des::EventType::controllable);
+  a.addEvent("b", des::EventType::uncontrollable);
+  a.addEvent("a", des::EventType::controllable);
+  a.setLinkFromStateToEvent("p", "a");
+  a.setLinkFromEventToState("a", "q", 2);
+  a.setLinkFromStateToEvent("q", "b");
+  a.setLinkFromEventToState("b", "p");
+  a.setLinkFromStateToEvent("p", "c");
+  a.setLinkFromEventToState("c", "p");
+  std::ostringstream o;
+  o << des::translateAutomationToDOT(a);
+  // states and events are ordered by names, arcs of each state are ordered by event names, an output arc of the state
+  // precedes an input arc with the same event
+  BOOST_CHECK_EQUAL(o.str(),
+    "# DES model generated file v0.1\n"
+    "digraph PetriNet {\n"
+    "\trankdir=LR\n"
+    "\tsubgraph place {\n"
+    "\t\tnode [shape=circle, fixedsize=true, label=\"\", height=0.5, width=0.5]\n"
+    "\t\t\"p_p\" [xlabel=<p<SUB>p</SUB>>][label=\"*1\"]\n"
+    "\t\t\"p_q\" [xlabel=<p<SUB>q</SUB>>]\n"
+    "\t}\n"
+    "\tsubgraph transition {\n"
+    "\tnode [style=filled, shape=rect, label=\"\", height=0.5, width=0.1]\n"
+    "\t\t\"t_a\" [xlabel=<t<SUB>a</SUB>>][fillcolor=cornflowerblue]\n"
+    "\t\t\"t_b\" [xlabel=<t<SUB>b</SUB>>][fillcolor=coral]\n"
+    "\t\t\"t_c\" [xlabel=<t<SUB>c</SUB>>][fillcolor=cornflowerblue]\n"
+    "\t}\n"
+    "\t\"p_p\" -> \"t_a\"\n"
+    "\t\"t_b\" -> \"p_p\"\n"
+    "\t\"p_p\" -> \"t_c\"\n"
+    "\t\"t_c\" -> \"p_p\"\n"
+    "\t\"t_a\" -> \"p_q\"[label=\"2\"]\n"
+    "\t\"p_q\" -> \"t_b\"\n"
+    "}\n");
+}
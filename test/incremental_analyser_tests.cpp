@@ -0,0 +1,166 @@
+/*! @file incremental_analyser_tests.cpp
+@ref des::IncrementalAnalyser class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "incremental_analyser.hpp"
+
+
+namespace {
+
+  // Net with a cycle p1 -> t1 -> p2 -> t2 -> p1, an event t3 never firing and a counter state c.
+  des::Automation makeNet() {
+    des::Automation a;
+    a.addState("p1", 1);
+    a.addState("p2");
+    a.addState("q");
+    a.addState("c");
+    for (const auto* e : { "t1", "t2", "t3" }) {
+      a.addEvent(e, des::EventType::controllable);
+    }
+    a.linkStatesByEvent("p1", "t1", "p2");
+    a.linkStatesByEvent("p2", "t2", "p1");
+    a.setLinkFromStateToEvent("q", "t3");
+    a.setLinkFromEventToState("t3", "p1");
+    a.setLinkFromEventToState("t1", "c");
+    a.enableChangeLog();
+    return a;
+  }
+
+  // Checks the result of incremental analysis by analysis anew.
+  void checkResult(const des::AnalysisResult& r, const des::Automation& a) {
+    const des::AnalysisResult expected = Analyser().run_analyse(a);
+    BOOST_CHECK(r.Alive == expected.Alive);
+    BOOST_CHECK(r.Coherent == expected.Coherent);
+    BOOST_CHECK(r.Safe == expected.Safe);
+    BOOST_CHECK(r.Reachable == expected.Reachable);
+    BOOST_CHECK(r.DeadEvents == expected.DeadEvents);
+    BOOST_CHECK(r.Disconnected == expected.Disconnected);
+    for (const auto& w : { std::make_pair(r.Deadlock, expected.Deadlock),
+      std::make_pair(r.Unbounded, expected.Unbounded) }) {
+      BOOST_REQUIRE(w.first.has_value() == w.second.has_value());
+      if (w.first) {
+        BOOST_CHECK(w.first->Events == w.second->Events);
+        BOOST_CHECK(w.first->Marking == w.second->Marking);
+      }
+    }
+  }
+
+} // namespace
+
+// Test of change log of automation.
+BOOST_AUTO_TEST_CASE(AutomationChangeLog) {
+  des::Automation a;
+  a.addState("p");
+  BOOST_CHECK(a.version() == 1 && !a.isChangeLogEnabled());
+  const des::Automation before = a.snapshot();
+  a.enableChangeLog();
+  BOOST_CHECK(!a.getChangesSince(before));
+  const des::Automation base = a.snapshot();
+  a.addEvent("t", des::EventType::uncontrollable);
+  a.linkStatesByEvent("p", "t", "p");
+  a.setActivity("p", 2);
+  a.removeState("p");
+  const auto changes = a.getChangesSince(base);
+  BOOST_REQUIRE(changes);
+  BOOST_REQUIRE(changes->size() == 7);
+  BOOST_CHECK(changes->at(0).Kind == des::ChangeKind::addEvent && changes->at(0).Event == "t");
+  BOOST_CHECK(changes->at(0).Value == static_cast<unsigned>(des::EventType::uncontrollable));
+  BOOST_CHECK(changes->at(1).Kind == des::ChangeKind::setInputLink && changes->at(1).Value == 1);
+  BOOST_CHECK(changes->at(2).Kind == des::ChangeKind::setOutputLink && changes->at(2).State == "p");
+  BOOST_CHECK(changes->at(3).Kind == des::ChangeKind::changeState && changes->at(3).Value == 2);
+  BOOST_CHECK(changes->at(4).Value == 0 && changes->at(5).Value == 0); // links are removed before the state
+  BOOST_CHECK(changes->at(6).Kind == des::ChangeKind::removeState && changes->at(6).State == "p");
+  BOOST_CHECK(base.getChangesSince(base)->empty());
+  BOOST_CHECK(!base.getChangesSince(a)); // the snapshot is older
+  des::Automation other = base.snapshot();
+  other.addState("r");
+  BOOST_CHECK(!a.getChangesSince(other)); // diverged copies
+  BOOST_CHECK(other.getChangesSince(base)->size() == 1);
+  a.disableChangeLog();
+  BOOST_CHECK(!a.getChangesSince(base));
+
+  des::Automation long_log;
+  long_log.enableChangeLog();
+  long_log.addState("p");
+  for (unsigned k = 0; k < 200000; k++) {
+    long_log.setActivity("p", k);
+  }
+  BOOST_CHECK(long_log.version() == 200001); // the log is destroyed without deep recursion
+}
+
+// Test of local updates keeping the state space.
+BOOST_AUTO_TEST_CASE(IncrementalUpdates) {
+  des::Automation a = makeNet();
+  des::IncrementalAnalyser an;
+  checkResult(an.analyse(a), a);
+  BOOST_CHECK(an.statistics().FullAnalyses == 1);
+
+  a.setActivity("c", 5); // the counter doesn't enable events
+  checkResult(an.analyse(a), a);
+  a.setLinkFromStateToEvent("p2", "t3", 2); // the event never fires
+  a.setLinkFromEventToState("t3", "q", 4);
+  checkResult(an.analyse(a), a);
+  a.addState("x", 3);
+  a.addEvent("u", des::EventType::controllable);
+  checkResult(an.analyse(a), a);
+  a.setLinkFromStateToEvent("x", "t3"); // the new state joins the main component
+  checkResult(an.analyse(a), a);
+  a.setActivity("q", 0);
+  checkResult(an.analyse(a), a);
+  a.removeEvent("u");
+  a.removeEvent("t3"); // the dead event is removed, the net becomes alive, q and x are disconnected
+  checkResult(an.analyse(a), a);
+  BOOST_CHECK(an.analyse(a).Alive == des::Verdict::yes);
+  a.removeState("x");
+  a.removeState("q");
+  a.getEvent("t1") = des::Event(des::EventType::uncontrollable);
+  checkResult(an.analyse(a), a);
+  BOOST_CHECK(an.analyse(a).Coherent == des::Verdict::yes);
+  BOOST_CHECK(an.statistics().FullAnalyses == 1);
+  BOOST_CHECK(an.statistics().ConnectivityRecomputations >= 1);
+}
+
+// Test of changes starting the analysis anew.
+BOOST_AUTO_TEST_CASE(IncrementalReanalysis) {
+  des::Automation a = makeNet();
+  des::IncrementalAnalyser an;
+  checkResult(an.analyse(a), a);
+  size_t full = an.statistics().FullAnalyses;
+  a.setLinkFromStateToEvent("p1", "t1", 2); // the live event is changed
+  checkResult(an.analyse(a), a);
+  BOOST_CHECK(an.statistics().FullAnalyses == ++full);
+  a.setActivity("q", 1); // the dead event fires
+  checkResult(an.analyse(a), a);
+  BOOST_CHECK(an.statistics().FullAnalyses == ++full);
+  a.setActivity("p1", 2);
+  checkResult(an.analyse(a), a);
+  BOOST_CHECK(an.statistics().FullAnalyses == ++full);
+  const des::Automation unrelated = makeNet();
+  checkResult(an.analyse(unrelated), unrelated);
+  BOOST_CHECK(an.statistics().FullAnalyses == ++full);
+  des::AnalysisOptions limited;
+  limited.MaxStates = 1;
+  des::IncrementalAnalyser inconclusive(limited);
+  inconclusive.analyse(a);
+  a.addState("y");
+  inconclusive.analyse(a);
+  BOOST_CHECK(inconclusive.statistics().FullAnalyses == 2);
+
+  des::Automation b; // the dead event without input links gets an input link
+  b.addState("p", 1);
+  b.addState("q");
+  b.addEvent("t", des::EventType::controllable);
+  b.addEvent("u", des::EventType::controllable);
+  b.linkStatesByEvent("p", "t", "q");
+  b.setLinkFromEventToState("u", "q");
+  b.enableChangeLog();
+  des::IncrementalAnalyser dead;
+  BOOST_CHECK(dead.analyse(b).DeadEvents == std::set<std::string>{ "u" });
+  b.setLinkFromStateToEvent("p", "u");
+  checkResult(dead.analyse(b), b);
+  BOOST_CHECK(dead.analyse(b).DeadEvents.empty());
+  BOOST_CHECK(dead.statistics().FullAnalyses == 2);
+}
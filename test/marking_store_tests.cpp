@@ -0,0 +1,44 @@
+/*! @file marking_store_tests.cpp
+@ref des::MarkingStore class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "marking_store.hpp"
+
+
+// Test of marking addition and search.
+BOOST_AUTO_TEST_CASE(MarkingStoreInsert) {
+  des::MarkingStore s(3);
+  BOOST_CHECK(s.size() == 0);
+  BOOST_CHECK((s.insert({ 1, 0, 0 }) == std::pair<size_t, bool>{ 0, true }));
+  BOOST_CHECK((s.insert({ 0, 1, 0 }, 0, 4) == std::pair<size_t, bool>{ 1, true }));
+  BOOST_CHECK((s.insert({ 1, 0, 0 }, 1, 2) == std::pair<size_t, bool>{ 0, false }));
+  BOOST_CHECK(s.find({ 0, 1, 0 }) == 1);
+  BOOST_CHECK(s.find({ 0, 0, 1 }) == des::MarkingStore::none);
+  BOOST_CHECK(s.getParent(0) == des::MarkingStore::none);
+  BOOST_CHECK(s.getEvent(0) == des::MarkingStore::none);
+  BOOST_CHECK(s.getParent(1) == 0);
+  BOOST_CHECK(s.getEvent(1) == 4);
+  des::Marking m;
+  s.get(1, m);
+  BOOST_CHECK((m == des::Marking{ 0, 1, 0 }));
+}
+
+// Test of hash table growth and firing sequences.
+BOOST_AUTO_TEST_CASE(MarkingStoreGrowth) {
+  des::MarkingStore s(2);
+  const unsigned count = 10000;
+  for (unsigned i = 0; i < count; i++) {
+    BOOST_REQUIRE(s.insert({ i, count - i }, i == 0 ? des::MarkingStore::none : i - 1, i % 7).second);
+  }
+  BOOST_CHECK(s.size() == count);
+  for (unsigned i = 0; i < count; i += 97) {
+    BOOST_CHECK(s.find({ i, count - i }) == i);
+  }
+  BOOST_CHECK(s.find({ count, 0 }) == des::MarkingStore::none);
+  const auto p = s.getPath(9);
+  BOOST_CHECK((p == std::vector<size_t>{ 1, 2, 3, 4, 5, 6, 0, 1, 2 }));
+  BOOST_CHECK(s.memory() >= count * 2 * sizeof(unsigned));
+}
@@ -0,0 +1,51 @@
+/*! @file monte_carlo_tests.cpp
+@ref des::MonteCarloRunner class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "monte_carlo.hpp"
+#include "test_nets.hpp"
+
+
+// Test of aggregated statistics of runs.
+BOOST_AUTO_TEST_CASE(MonteCarloStatistics) {
+  const des::CompiledNet n(makeRing(4));
+  des::MonteCarloOptions o;
+  o.Runs = 100;
+  o.Steps = 3;
+  const auto r = des::MonteCarloRunner(n, o).run();
+  BOOST_CHECK(r.Runs == 100 && r.Steps == 300 && r.Deadlocks == 0 && r.DeadlockRate == 0.0);
+  BOOST_CHECK((r.Firings == std::vector<uint64_t>{ 100, 100, 100, 0 }));
+  BOOST_CHECK(r.FiringFrequencies[0] == 1.0 / 3 && r.FiringFrequencies[3] == 0.0);
+  BOOST_CHECK((r.MeanTokens == std::vector<double>{ 0.25, 0.25, 0.25, 0.25 })); // the token visits each state once
+
+  o.Simulation.Priorities = std::vector<int>(5);
+  BOOST_CHECK_THROW(des::MonteCarloRunner(n, o).run(), std::invalid_argument);
+}
+
+// Test of deadlock rate and independence of results from threads.
+BOOST_AUTO_TEST_CASE(MonteCarloThreads) {
+  des::Automation a; // each step stops in "done" with probability 1/2
+  a.addState("p", 1);
+  a.addState("done");
+  a.addEvent("stop", des::EventType::controllable);
+  a.addEvent("stay", des::EventType::controllable);
+  a.linkStatesByEvent("p", "stop", "done");
+  a.linkStatesByEvent("p", "stay", "p");
+  const des::CompiledNet n(a);
+  des::MonteCarloOptions o;
+  o.Runs = 4000;
+  o.Steps = 3;
+  o.Simulation.Seed = 11;
+  o.Threads = 1;
+  const auto single = des::MonteCarloRunner(n, o).run();
+  BOOST_CHECK(single.DeadlockRate > 0.85 && single.DeadlockRate < 0.90); // 1 - 1/8
+  o.Threads = 4;
+  const auto parallel = des::MonteCarloRunner(n, o).run();
+  BOOST_CHECK(parallel.Deadlocks == single.Deadlocks && parallel.Firings == single.Firings);
+  BOOST_CHECK(parallel.MeanTokens == single.MeanTokens);
+  o.Simulation.Seed = 12;
+  BOOST_CHECK(des::MonteCarloRunner(n, o).run().Firings != single.Firings);
+}
@@ -0,0 +1,136 @@
+/*! @file net_binary_tests.cpp
+Binary format of Petri nets and @ref des::MappedNet class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+
+#include "net_binary.hpp"
+
+
+namespace {
+
+  // Net with weighted links and a macro event.
+  des::Automation makeNet() {
+    des::Automation a;
+    a.addState("p1", 2);
+    a.addState("p2");
+    a.addState("p3", 1);
+    a.addEvent("t1", des::EventType::controllable);
+    a.addEvent("t2", des::EventType::uncontrollable);
+    des::Event m(des::EventType::macro);
+    m.addMaskedEvent("t1");
+    m.addMaskedEvent("t2");
+    a.addEvent("macro", m);
+    a.setLinkFromStateToEvent("p1", "t1", 2);
+    a.setLinkFromStateToEvent("p3", "t1");
+    a.setLinkFromEventToState("t1", "p2", 3);
+    a.linkStatesByEvent("p2", "t2", "p1");
+    return a;
+  }
+
+  // Binary image of automation in aligned memory.
+  std::vector<uint64_t> makeImage(const des::Automation& a) {
+    std::ostringstream o;
+    des::writeBinaryNet(o, a);
+    const std::string s = o.str();
+    std::vector<uint64_t> result(s.size() / sizeof(uint64_t));
+    BOOST_REQUIRE(s.size() % sizeof(uint64_t) == 0);
+    std::memcpy(result.data(), s.data(), s.size());
+    return result;
+  }
+
+} // namespace
+
+// Test of in-place access to binary net.
+BOOST_AUTO_TEST_CASE(MappedNetView) {
+  const des::Automation a = makeNet();
+  const auto image = makeImage(a);
+  const des::MappedNet m(image.data(), image.size() * sizeof(uint64_t));
+  BOOST_CHECK(m.getStateQuantity() == 3);
+  BOOST_CHECK(m.getEventQuantity() == 3);
+  BOOST_CHECK(m.getStateName(0) == "p1");
+  BOOST_CHECK(m.getActivity(0) == 2);
+  BOOST_CHECK(m.getEventName(0) == "macro");
+  BOOST_CHECK(m.getType(0) == des::EventType::macro);
+  BOOST_REQUIRE(m.getMaskedEventQuantity(0) == 2);
+  BOOST_CHECK(m.getMaskedEvent(0, 1) == "t2");
+  BOOST_CHECK(m.getMaskedEventQuantity(1) == 0);
+  const auto inputs = m.getEventInputs(1);
+  BOOST_REQUIRE(inputs.size() == 2);
+  BOOST_CHECK(inputs.begin()[0].Index == 0 && inputs.begin()[0].Multiplicity == 2);
+  BOOST_CHECK(inputs.begin()[1].Index == 2 && inputs.begin()[1].Multiplicity == 1);
+  BOOST_CHECK(reinterpret_cast<const char*>(inputs.begin()) > reinterpret_cast<const char*>(image.data()));
+  BOOST_CHECK(m.getOutputs().size() == 2);
+
+  const des::CompiledNet c(m), d(a);
+  BOOST_CHECK(c.getInitialMarking() == d.getInitialMarking());
+  for (size_t t = 0; t < c.getEventQuantity(); t++) {
+    BOOST_CHECK(c.getEventName(t) == d.getEventName(t));
+    BOOST_CHECK(c.getEventInputs(t).size() == d.getEventInputs(t).size());
+    BOOST_CHECK(c.getEventOutputs(t).size() == d.getEventOutputs(t).size());
+  }
+}
+
+// Test of file round trip.
+BOOST_AUTO_TEST_CASE(MappedNetFile) {
+  const des::Automation a = makeNet();
+  const std::string path = "des-binary-net-test.desb";
+  des::writeBinaryNetFile(path, a);
+  {
+    const des::MappedNet m(path);
+    const des::Automation b = m.toAutomation();
+    BOOST_CHECK(b.getStateNameSet() == a.getStateNameSet());
+    BOOST_CHECK(b.getEventNameSet() == a.getEventNameSet());
+    for (const auto& e : a.getEventNameSet()) {
+      BOOST_CHECK(b.getEventCopy(e) == a.getEventCopy(e));
+      BOOST_CHECK(b.getEventInputs(e) == a.getEventInputs(e));
+      BOOST_CHECK(b.getEventOutputs(e) == a.getEventOutputs(e));
+      for (const auto& s : a.getEventInputs(e)) {
+        BOOST_CHECK(b.getLinksFromStateToEvent(s, e) == a.getLinksFromStateToEvent(s, e));
+      }
+    }
+    for (const auto& s : a.getStateNameSet()) {
+      BOOST_CHECK(b.getActivity(s) == a.getActivity(s));
+      BOOST_CHECK(b.getStateInputs(s) == a.getStateInputs(s));
+      BOOST_CHECK(b.getStateOutputs(s) == a.getStateOutputs(s));
+    }
+  }
+  std::remove(path.c_str());
+  BOOST_CHECK_THROW(des::MappedNet("/nonexistent/net.desb"), std::runtime_error);
+}
+
+// Test of invalid binary nets.
+BOOST_AUTO_TEST_CASE(MappedNetInvalid) {
+  const auto image = makeImage(makeNet());
+  const size_t size = image.size() * sizeof(uint64_t);
+  BOOST_CHECK_THROW(des::MappedNet(image.data(), size - 8), std::runtime_error);
+  auto broken = image;
+  reinterpret_cast<des::BinaryNetHeader*>(broken.data())->Version = 2;
+  BOOST_CHECK_THROW(des::MappedNet(broken.data(), size), std::runtime_error);
+  broken = image;
+  reinterpret_cast<des::BinaryNetHeader*>(broken.data())->InputArcs = size;
+  BOOST_CHECK_THROW(des::MappedNet(broken.data(), size), std::runtime_error);
+  broken = image;
+  const auto& h = *reinterpret_cast<const des::BinaryNetHeader*>(image.data());
+  reinterpret_cast<des::Arc*>(reinterpret_cast<char*>(broken.data()) + h.InputArcs)->Index = 7;
+  BOOST_CHECK_THROW(des::MappedNet(broken.data(), size), std::runtime_error);
+  broken = image;
+  reinterpret_cast<des::Arc*>(reinterpret_cast<char*>(broken.data()) + h.InputArcs)->Multiplicity = 0;
+  BOOST_CHECK_THROW(des::MappedNet(broken.data(), size), std::runtime_error);
+  // the event t1 has the input links from p1 and p3
+  const des::MappedNet view(image.data(), size);
+  BOOST_REQUIRE(view.getEventName(1) == "t1" && view.getEventInputs(1).size() == 2);
+  const auto t1 = reinterpret_cast<const uint32_t*>(reinterpret_cast<const char*>(image.data()) + h.InputOffsets)[1];
+  broken = image;
+  auto* arcs = reinterpret_cast<des::Arc*>(reinterpret_cast<char*>(broken.data()) + h.InputArcs) + t1;
+  std::swap(arcs[0], arcs[1]);
+  BOOST_CHECK_THROW(des::MappedNet(broken.data(), size), std::runtime_error);
+  arcs[0].Index = arcs[1].Index;
+  BOOST_CHECK_THROW(des::MappedNet(broken.data(), size), std::runtime_error);
+}
@@ -0,0 +1,77 @@
+/*! @file net_text_tests.cpp
+Text format of Petri nets tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <limits>
+#include <sstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include "net_text.hpp"
+
+
+// Test of reading and writing back.
+BOOST_AUTO_TEST_CASE(ReadWriteNet) {
+  std::istringstream i(
+    "# producer and consumer\n"
+    "state p1 1\n"
+    "state p2   # empty\n"
+    "\n"
+    "event t1\n"
+    "event t2 uncontrollable\n"
+    "arc p1 t1\n"
+    "arc t1 p2 2\n"
+    "arc p2 t2 2\n"
+    "arc t2 p1\n");
+  const des::Automation a = des::readNet(i);
+  BOOST_CHECK(a.getStateQuantity() == 2);
+  BOOST_CHECK(a.getEventQuantity() == 2);
+  BOOST_CHECK(a.getActivity("p1") == 1);
+  BOOST_CHECK(a.getActivity("p2") == 0);
+  BOOST_CHECK(a.getEventCopy("t2").type() == des::EventType::uncontrollable);
+  BOOST_CHECK(a.getLinksFromEventToState("t1", "p2") == 2);
+  BOOST_CHECK(a.getLinksFromStateToEvent("p2", "t2") == 2);
+  std::ostringstream o;
+  des::writeNet(o, a);
+  std::istringstream r(o.str());
+  const des::Automation b = des::readNet(r);
+  std::ostringstream ob;
+  des::writeNet(ob, b);
+  BOOST_CHECK(o.str() == ob.str());
+  BOOST_CHECK(b.getLinksFromStateToEvent("p1", "t1") == 1);
+
+  des::Automation large; // the greatest values are written and read back
+  const unsigned max = std::numeric_limits<unsigned>::max();
+  large.addState("p", max);
+  large.addEvent("t", des::EventType::controllable);
+  large.setLinkFromStateToEvent("p", "t", max);
+  large.setLinkFromEventToState("t", "p", 1000000000);
+  std::ostringstream ol;
+  des::writeNet(ol, large);
+  std::istringstream rl(ol.str());
+  const des::Automation c = des::readNet(rl);
+  BOOST_CHECK(c.getActivity("p") == max && c.getLinksFromStateToEvent("p", "t") == max);
+  BOOST_CHECK(c.getLinksFromEventToState("t", "p") == 1000000000);
+}
+
+// Test of syntax errors.
+BOOST_AUTO_TEST_CASE(ReadNetErrors) {
+  const std::vector<std::string> invalid = {
+    "place p1\n",
+    "state p1 x\n",
+    "state p1 1 2\n",
+    "state p1 4294967296\n",
+    "state p1 99999999999999999999999\n",
+    "event t1 fast\n",
+    "state p1\nstate p2\narc p1 p2\n",
+    "state p1\narc p1 t1\n",
+  };
+  for (const auto& s : invalid) {
+    std::istringstream i(s);
+    BOOST_CHECK_THROW(des::readNet(i), std::runtime_error);
+  }
+  std::istringstream d("state p1\nstate p1\n");
+  BOOST_CHECK_THROW(des::readNet(d), std::invalid_argument);
+  BOOST_CHECK_THROW(des::readNetFile("/nonexistent/net.net"), std::runtime_error);
+}
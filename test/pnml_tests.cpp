@@ -0,0 +1,99 @@
+/*! @file pnml_tests.cpp
+PNML importer tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <sstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include "pnml.hpp"
+
+
+// Test of import of place/transition net.
+BOOST_AUTO_TEST_CASE(ReadPnml) {
+  std::istringstream i(R"(<?xml version="1.0" encoding="UTF-8"?>
+<!-- exported by a modelling tool -->
+<pnml xmlns="http://www.pnml.org/version-2009/grammar/pnml">
+  <net id="net1" type="http://www.pnml.org/version-2009/grammar/ptnet">
+    <name><text>Producer &amp; consumer</text></name>
+    <page id="page1">
+      <place id="p1">
+        <name><text>ready</text><graphics><offset x="0" y="0"/></graphics></name>
+        <initialMarking><text> 2 </text></initialMarking>
+        <graphics><position x="10" y="20"/></graphics>
+      </place>
+      <place id="2-buffer"/>
+      <transition id="t1"><name><text>produce</text></name></transition>
+      <arc id="a1" source="p1" target="t1"/>
+      <arc id="a2" source="t1" target="ref"><inscription><text><![CDATA[3]]></text></inscription></arc>
+      <arc id="a3" source="t1" target="ref"/>
+      <toolspecific tool="x" version="1"><data><![CDATA[<place id="fake"/>]]></data></toolspecific>
+    </page>
+    <page id="page2">
+      <referencePlace id="ref" ref="2-buffer"/>
+      <transition id="t.2"/>
+      <arc id="a4" source='2-buffer' target='t.2'><inscription><text>2</text></inscription></arc>
+    </page>
+  </net>
+</pnml>
+)");
+  des::PnmlStatistics s;
+  const des::Automation a = des::readPnml(i, &s);
+  BOOST_CHECK((a.getStateNameSet() == std::set<std::string>{ "p1", "n_2_buffer" }));
+  BOOST_CHECK((a.getEventNameSet() == std::set<std::string>{ "t1", "t_2" }));
+  BOOST_CHECK(a.getActivity("p1") == 2);
+  BOOST_CHECK(a.getActivity("n_2_buffer") == 0);
+  BOOST_CHECK(a.getLinksFromStateToEvent("p1", "t1") == 1);
+  BOOST_CHECK(a.getLinksFromEventToState("t1", "n_2_buffer") == 4); // parallel arcs are merged
+  BOOST_CHECK(a.getLinksFromStateToEvent("n_2_buffer", "t_2") == 2);
+  BOOST_CHECK((a.getStateInputs("n_2_buffer") == std::set<std::string>{ "t1" }));
+  BOOST_CHECK((a.getEventInputs("t1") == std::set<std::string>{ "p1" }));
+  BOOST_CHECK(s.Places == 2);
+  BOOST_CHECK(s.Transitions == 2);
+  BOOST_CHECK(s.Arcs == 3);
+  BOOST_CHECK(s.Bytes == i.str().size());
+}
+
+// Test of large document read by chunks.
+BOOST_AUTO_TEST_CASE(ReadPnmlLarge) {
+  const unsigned n = 5000;
+  std::ostringstream o;
+  o << "<pnml><net id=\"n\"><page id=\"g\">\n";
+  for (unsigned k = 0; k < n; k++) {
+    o << "<place id=\"p" << k << "\"><initialMarking><text>" << (k == 0) << "</text></initialMarking>"
+      << "<graphics><position x=\"" << k << "\" y=\"0\"/></graphics></place>\n"
+      << "<transition id=\"t" << k << "\"/>\n"
+      << "<arc id=\"i" << k << "\" source=\"p" << k << "\" target=\"t" << k << "\"/>\n"
+      << "<arc id=\"o" << k << "\" source=\"t" << k << "\" target=\"p" << (k + 1) % n << "\"/>\n";
+  }
+  o << "</page></net></pnml>\n";
+  std::istringstream i(o.str());
+  des::PnmlStatistics s;
+  const des::Automation a = des::readPnml(i, &s);
+  BOOST_CHECK(a.getStateQuantity() == n);
+  BOOST_CHECK(a.getEventQuantity() == n);
+  BOOST_CHECK(a.getActivity("p0") == 1);
+  BOOST_CHECK(a.getLinksFromEventToState("t4999", "p0") == 1);
+  BOOST_CHECK(s.Arcs == 2 * n);
+  BOOST_CHECK(s.Bytes == o.str().size());
+}
+
+// Test of malformed documents.
+BOOST_AUTO_TEST_CASE(ReadPnmlErrors) {
+  const std::vector<std::string> invalid = {
+    "<net id=\"n\"/>",
+    "<pnml><net id=\"n\"><place id=\"p\">",
+    "<pnml><place/></pnml>",
+    "<pnml><place id=\"p\"/><place id=\"p\"/></pnml>",
+    "<pnml><place id=\"p\"/><arc id=\"a\" source=\"p\" target=\"x\"/></pnml>",
+    "<pnml><place id=\"p\"/><place id=\"q\"/><arc id=\"a\" source=\"p\" target=\"q\"/></pnml>",
+    "<pnml><place id=\"p\"><initialMarking><text>many</text></initialMarking></place></pnml>",
+    "<pnml><place id=\"p&unknown;\"/></pnml>",
+  };
+  for (const auto& d : invalid) {
+    std::istringstream i(d);
+    BOOST_CHECK_THROW(des::readPnml(i), std::runtime_error);
+  }
+  BOOST_CHECK_THROW(des::readPnmlFile("/nonexistent/net.pnml"), std::runtime_error);
+}
@@ -0,0 +1,123 @@
+/*! @file property_checker_tests.cpp
+@ref des::PropertyChecker class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "property_checker.hpp"
+
+
+namespace {
+
+  // Net with a terminal state and a generator of tokens in state q.
+  des::Automation makeGenerator() {
+    des::Automation a;
+    a.addState("p1", 1);
+    a.addState("p2");
+    a.addState("p3");
+    a.addState("q");
+    a.addEvent("t1", des::EventType::controllable);
+    a.addEvent("t2", des::EventType::controllable);
+    a.addEvent("gen", des::EventType::controllable);
+    a.linkStatesByEvent("p1", "t1", "p2");
+    a.linkStatesByEvent("p2", "t2", "p3"); // p3 is terminal
+    a.setLinkFromStateToEvent("p1", "gen");
+    a.setLinkFromEventToState("gen", "p1");
+    a.setLinkFromEventToState("gen", "q"); // q is unbounded
+    return a;
+  }
+
+} // namespace
+
+// Test of violations found by on-the-fly check.
+BOOST_AUTO_TEST_CASE(PropertyCheckerViolations) {
+  const des::Automation a = makeGenerator();
+  const des::CompiledNet n(a);
+  des::PropertyChecker c(n);
+  const size_t deadlock = c.addDeadlockFreedom();
+  const size_t bound = c.addBound({ "q" }, 3, "q bound");
+  const size_t q = n.getStateIndex("q");
+  const size_t target = c.addTarget([q](const des::Marking& m) { return m[q] == 2; }, "two tokens");
+  const auto r = c.run();
+  BOOST_CHECK(r.Status == des::AnalysisStatus::complete);
+  BOOST_CHECK(r.decided());
+  BOOST_REQUIRE(r.Properties.size() == 3);
+  BOOST_CHECK(r.Properties[bound].Name == "q bound");
+  BOOST_CHECK(r.Properties[deadlock].Value == des::Verdict::no);
+  BOOST_REQUIRE(r.Properties[deadlock].Trace);
+  BOOST_CHECK((r.Properties[deadlock].Trace->Events == std::vector<std::string>{ "t1", "t2" }));
+  BOOST_CHECK(r.Properties[deadlock].Trace->Marking.at("p3") == 1);
+  BOOST_CHECK(r.Properties[bound].Value == des::Verdict::no);
+  BOOST_REQUIRE(r.Properties[bound].Trace);
+  BOOST_CHECK(r.Properties[bound].Trace->Events == std::vector<std::string>(4, "gen"));
+  BOOST_CHECK(r.Properties[bound].Trace->Marking.at("q") == 4);
+  BOOST_CHECK(r.Properties[target].Value == des::Verdict::yes);
+  BOOST_REQUIRE(r.Properties[target].Trace);
+  BOOST_CHECK(r.Properties[target].Trace->Events.size() == 2);
+  BOOST_CHECK(r.Properties[target].States <= r.Properties[bound].States);
+  BOOST_CHECK(r.Statistics.Frontier > 0); // the net is unbounded, exploration is stopped early
+}
+
+// Test of early termination and exhaustive verdicts.
+BOOST_AUTO_TEST_CASE(PropertyCheckerEarlyStop) {
+  des::Automation a;
+  const unsigned pairs = 8;
+  for (unsigned i = 0; i < pairs; i++) {
+    const std::string s = std::to_string(i);
+    a.addState("p" + s, 1);
+    a.addState("q" + s);
+    a.addEvent("on" + s, des::EventType::controllable);
+    a.addEvent("off" + s, des::EventType::controllable);
+    a.linkStatesByEvent("p" + s, "on" + s, "q" + s);
+    a.linkStatesByEvent("q" + s, "off" + s, "p" + s);
+  }
+  const des::CompiledNet n(a);
+  const size_t q = n.getStateIndex("q0");
+  des::PropertyChecker early(n);
+  early.addTarget([q](const des::Marking& m) { return m[q] == 1; });
+  auto r = early.run();
+  BOOST_CHECK(r.Properties[0].Value == des::Verdict::yes);
+  BOOST_CHECK((r.Properties[0].Trace->Events == std::vector<std::string>{ "on0" }));
+  BOOST_CHECK(r.Statistics.States < (1u << pairs));
+
+  des::PropertyChecker full(n);
+  full.addDeadlockFreedom();
+  full.addBound({});
+  full.addTarget([](const des::Marking& m) { return m[0] == 2; });
+  r = full.run();
+  BOOST_CHECK(r.Status == des::AnalysisStatus::complete);
+  BOOST_CHECK(r.Statistics.States == 1u << pairs);
+  BOOST_CHECK(r.Statistics.Frontier == 0);
+  BOOST_CHECK(r.Properties[0].Value == des::Verdict::yes);
+  BOOST_CHECK(r.Properties[1].Value == des::Verdict::yes);
+  BOOST_CHECK(r.Properties[2].Value == des::Verdict::no);
+  BOOST_CHECK(!r.Properties[2].Trace);
+}
+
+// Test of limits and invalid properties.
+BOOST_AUTO_TEST_CASE(PropertyCheckerLimits) {
+  const des::Automation a = makeGenerator();
+  const des::CompiledNet n(a);
+  des::PropertyChecker c(n);
+  BOOST_CHECK_THROW(auto r = c.run(), std::logic_error);
+  BOOST_CHECK_THROW(c.addBound({ "absent" }), std::invalid_argument);
+  BOOST_CHECK_THROW(c.addTarget(nullptr), std::invalid_argument);
+  c.addBound({ "p1", "p2", "p3" });
+  des::AnalysisOptions o;
+  o.MaxStates = 50;
+  size_t reports = 0;
+  o.Progress = [&](const des::AnalysisProgress&) { reports++; };
+  auto r = c.run(o);
+  BOOST_CHECK(r.Status == des::AnalysisStatus::stateLimit);
+  BOOST_CHECK(r.Properties[0].Value == des::Verdict::unknown);
+  BOOST_CHECK(!r.decided());
+  BOOST_CHECK(r.Statistics.States >= 50);
+  BOOST_CHECK(reports >= 1);
+  des::CancellationToken t;
+  t.cancel();
+  o.Cancellation = &t;
+  r = c.run(o);
+  BOOST_CHECK(r.Status == des::AnalysisStatus::cancelled);
+  BOOST_CHECK(r.Statistics.States == 1);
+}
@@ -0,0 +1,163 @@
+/*! @file result_cache_tests.cpp
+@ref des::ResultCache class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "analyse.hpp"
+#include "result_cache.hpp"
+
+
+namespace {
+
+  // Directory of cache removed after test.
+  struct CacheDirectory {
+    const std::string Path = "des-result-cache-test";
+    CacheDirectory() {
+      std::filesystem::remove_all(Path);
+    }
+    ~CacheDirectory() {
+      std::filesystem::remove_all(Path);
+    }
+  };
+
+  // Net with a deadlock after two events.
+  des::Automation makeNet(unsigned tokens) {
+    des::Automation a;
+    a.addState("p1", tokens);
+    a.addState("p2");
+    a.addState("p3");
+    a.addEvent("t1", des::EventType::controllable);
+    a.addEvent("t2", des::EventType::controllable);
+    a.linkStatesByEvent("p1", "t1", "p2");
+    a.linkStatesByEvent("p2", "t2", "p3");
+    return a;
+  }
+
+} // namespace
+
+// Test of results stored and returned by analyser.
+BOOST_AUTO_TEST_CASE(ResultCacheHit) {
+  const CacheDirectory d;
+  const des::Automation a = makeNet(1);
+  des::ResultCache cache(d.Path);
+  des::AnalysisOptions o;
+  o.Cache = &cache;
+  const Analyser an;
+  const des::AnalysisResult r = an.run_analyse(a, o);
+  BOOST_CHECK(cache.size() == 1);
+  BOOST_CHECK(cache.bytes() > 0);
+  const auto cached = cache.find(a.fingerprint(), o);
+  BOOST_REQUIRE(cached);
+  BOOST_CHECK(cached->Alive == r.Alive && cached->Safe == r.Safe && cached->Reachable == r.Reachable);
+  BOOST_CHECK(cached->Statistics.States == r.Statistics.States);
+  BOOST_CHECK(cached->DeadEvents == r.DeadEvents);
+  BOOST_REQUIRE(cached->Deadlock);
+  BOOST_CHECK(cached->Deadlock->Events == r.Deadlock->Events);
+  BOOST_CHECK(cached->Deadlock->Marking == r.Deadlock->Marking);
+  BOOST_CHECK(!cache.find(makeNet(2).fingerprint(), o));
+  des::AnalysisOptions limited = o;
+  limited.MaxStates = 1;
+  BOOST_CHECK(!cache.find(a.fingerprint(), limited));
+  const des::AnalysisResult l = an.run_analyse(a, limited);
+  BOOST_CHECK(l.Status == des::AnalysisStatus::stateLimit);
+  BOOST_CHECK(cache.size() == 2);
+  limited.TimeLimit = std::chrono::milliseconds(1000); // the time limit isn't a part of the key
+  BOOST_CHECK(an.run_analyse(a, limited).Status == des::AnalysisStatus::stateLimit);
+  BOOST_CHECK(an.run_analyse(a, limited).Statistics.States == l.Statistics.States);
+
+  des::AnalysisResult cancelled = r;
+  cancelled.Status = des::AnalysisStatus::cancelled;
+  BOOST_CHECK(!cache.insert(makeNet(3).fingerprint(), o, cancelled));
+  BOOST_CHECK(cache.size() == 2);
+}
+
+// Test of persistence, damaged values and clearing.
+BOOST_AUTO_TEST_CASE(ResultCachePersistence) {
+  const CacheDirectory d;
+  const des::Fingerprint f = makeNet(1).fingerprint();
+  const des::AnalysisOptions o;
+  {
+    des::ResultCache cache(d.Path);
+    BOOST_CHECK(cache.insert(f, o, Analyser().run_analyse(makeNet(1))));
+  }
+  des::ResultCache cache(d.Path);
+  BOOST_CHECK(cache.size() == 1);
+  BOOST_CHECK(cache.find(f, o));
+  for (const auto& e : std::filesystem::directory_iterator(d.Path)) {
+    if (e.path().extension() == ".result") {
+      std::ofstream(e.path(), std::ios::binary | std::ios::trunc) << "damaged";
+    }
+  }
+  BOOST_CHECK(!cache.find(f, o));
+  BOOST_CHECK(cache.size() == 0 && cache.bytes() == 0);
+  BOOST_CHECK(cache.insert(f, o, Analyser().run_analyse(makeNet(1))));
+  cache.clear();
+  BOOST_CHECK(cache.size() == 0);
+  BOOST_CHECK(std::distance(std::filesystem::directory_iterator(d.Path), std::filesystem::directory_iterator()) == 1);
+}
+
+// Test of eviction of the least recently used results.
+BOOST_AUTO_TEST_CASE(ResultCacheEviction) {
+  const CacheDirectory d;
+  const des::AnalysisOptions o;
+  const des::AnalysisResult r = Analyser().run_analyse(makeNet(1));
+  std::vector<des::Fingerprint> keys;
+  for (unsigned k = 1; k <= 6; k++) {
+    keys.push_back(makeNet(k).fingerprint());
+  }
+  uint64_t value_size = 0;
+  {
+    des::ResultCache probe(d.Path + "/probe");
+    probe.insert(keys[0], o, r);
+    value_size = probe.bytes();
+  }
+  des::ResultCache by_size(d.Path + "/size", 3 * value_size);
+  for (size_t k = 0; k < 3; k++) {
+    BOOST_CHECK(by_size.insert(keys[k], o, r));
+  }
+  BOOST_CHECK(by_size.find(keys[0], o)); // keys[1] becomes the least recently used
+  BOOST_CHECK(by_size.insert(keys[3], o, r));
+  BOOST_CHECK(by_size.size() == 3 && by_size.bytes() == 3 * value_size);
+  BOOST_CHECK(by_size.find(keys[0], o) && !by_size.find(keys[1], o) && by_size.find(keys[2], o));
+
+  des::ResultCache by_entries(d.Path + "/entries", des::default_cache_size, 2);
+  by_entries.insert(keys[4], o, r);
+  by_entries.insert(keys[5], o, r);
+  by_entries.insert(keys[0], o, r);
+  BOOST_CHECK(by_entries.size() == 2 && !by_entries.find(keys[4], o));
+}
+
+// Test of concurrent use of one directory by several cache objects.
+BOOST_AUTO_TEST_CASE(ResultCacheSharing) {
+  const CacheDirectory d;
+  const des::AnalysisOptions o;
+  const des::AnalysisResult r = Analyser().run_analyse(makeNet(1));
+  const size_t threads = 4, nets = 50;
+  std::vector<std::thread> pool;
+  for (size_t t = 0; t < threads; t++) {
+    pool.emplace_back([&]() {
+      des::ResultCache cache(d.Path); // own descriptor of the index as in other process
+      for (unsigned k = 1; k <= nets; k++) {
+        const des::Fingerprint f = makeNet(k).fingerprint();
+        if (!cache.find(f, o)) {
+          cache.insert(f, o, r);
+        }
+      }
+    });
+  }
+  for (auto& t : pool) {
+    t.join();
+  }
+  des::ResultCache cache(d.Path);
+  BOOST_CHECK(cache.size() == nets);
+  for (unsigned k = 1; k <= nets; k++) {
+    BOOST_CHECK(cache.find(makeNet(k).fingerprint(), o));
+  }
+}
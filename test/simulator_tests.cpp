@@ -0,0 +1,124 @@
+/*! @file simulator_tests.cpp
+@ref des::Simulator class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "simulator.hpp"
+#include "test_nets.hpp"
+
+
+namespace {
+
+  // Net with a choice between two events: "a" returns the token, "b" doubles it, "c" consumes two tokens.
+  des::Automation makeChoice() {
+    des::Automation a;
+    a.addState("p", 1);
+    a.addState("q");
+    a.addEvent("a", des::EventType::controllable);
+    a.addEvent("b", des::EventType::controllable);
+    a.addEvent("c", des::EventType::controllable);
+    a.setLinkFromStateToEvent("p", "a");
+    a.setLinkFromEventToState("a", "p");
+    a.setLinkFromStateToEvent("p", "b");
+    a.setLinkFromEventToState("b", "q", 2);
+    a.setLinkFromStateToEvent("q", "c", 2);
+    a.setLinkFromEventToState("c", "p");
+    return a;
+  }
+
+} // namespace
+
+// Test of steps against firing of compiled net.
+BOOST_AUTO_TEST_CASE(SimulatorSteps) {
+  des::Automation a = makeRing(5, 3);
+  a.addState("extra", 2);
+  a.addEvent("join", des::EventType::controllable);
+  a.setLinkFromStateToEvent("p2", "join", 2);
+  a.setLinkFromStateToEvent("extra", "join");
+  a.setLinkFromEventToState("join", "p0", 3);
+  const des::CompiledNet n(a);
+  for (const auto policy : { des::FiringPolicy::random, des::FiringPolicy::priority, des::FiringPolicy::roundRobin }) {
+    des::SimulatorOptions o;
+    o.Policy = policy;
+    o.Priorities = { 1, 0, 0, 2 };
+    des::Simulator s(n, o);
+    des::Marking m = n.getInitialMarking(), r;
+    for (int k = 0; k < 500; k++) {
+      const size_t t = s.step();
+      if (t == des::Simulator::none) {
+        break;
+      }
+      BOOST_REQUIRE(n.isReady(m, t));
+      n.fire(m, t, r);
+      m = r;
+      BOOST_REQUIRE(s.getMarking() == m);
+      size_t ready = 0;
+      for (size_t e = 0; e < n.getEventQuantity(); e++) {
+        ready += n.isReady(m, e) ? 1 : 0;
+      }
+      BOOST_REQUIRE(s.getReadyQuantity() == ready);
+    }
+  }
+
+  des::SimulatorOptions o;
+  o.Policy = des::FiringPolicy::roundRobin;
+  des::Simulator ring(n, o);
+  const auto r = ring.run(2);
+  BOOST_CHECK(r.Steps == 2 && !r.Deadlock);
+  BOOST_CHECK(ring.getFiringCounts()[n.getEventIndex("join")] == 0 && ring.getFiringCounts()[1] == 1);
+  BOOST_CHECK_THROW(des::Simulator(n, { des::FiringPolicy::priority, 0, 0, std::vector<int>(10) }),
+    std::invalid_argument);
+}
+
+// Test of firing policies, reproducibility and deadlocks.
+BOOST_AUTO_TEST_CASE(SimulatorPolicies) {
+  const des::CompiledNet choice(makeChoice());
+  const size_t a = choice.getEventIndex("a"), b = choice.getEventIndex("b"), c = choice.getEventIndex("c");
+
+  des::SimulatorOptions o;
+  o.Seed = 42;
+  des::Simulator random(choice, o);
+  const auto r = random.run(100000);
+  BOOST_CHECK(r.Steps == 100000 && !r.Deadlock && r.FiringsPerSecond > 0.0);
+  const auto counts = random.getFiringCounts();
+  BOOST_CHECK(counts[a] > 30000 && counts[b] > 20000 && counts[c] > 20000); // a and b are equally likely from p
+  random.reset();
+  random.run(100000);
+  BOOST_CHECK(random.getFiringCounts() == counts);
+  o.Seed = 43;
+  des::Simulator other(choice, o);
+  other.run(100000);
+  BOOST_CHECK(other.getFiringCounts() != counts);
+
+  o.Policy = des::FiringPolicy::priority;
+  o.Priorities = { 0, 1 }; // b is preferred to a
+  des::Simulator priority(choice, o);
+  priority.run(1000);
+  BOOST_CHECK(priority.getFiringCounts()[a] == 0 && priority.getFiringCounts()[b] == 500);
+
+  o.Policy = des::FiringPolicy::roundRobin;
+  des::Simulator cyclic(choice, o);
+  cyclic.run(3);
+  BOOST_CHECK((cyclic.getFiringCounts() == std::vector<uint64_t>{ 1, 1, 1 })); // a, b, c
+  BOOST_CHECK(cyclic.getStepQuantity() == 3);
+
+  des::Automation chain;
+  chain.addState("p0", 1);
+  chain.addState("p1");
+  chain.addState("p2");
+  chain.addEvent("t0", des::EventType::controllable);
+  chain.addEvent("t1", des::EventType::controllable);
+  chain.linkStatesByEvent("p0", "t0", "p1");
+  chain.linkStatesByEvent("p1", "t1", "p2");
+  const des::CompiledNet n(chain);
+  des::Simulator s(n);
+  const auto d = s.run(10);
+  BOOST_CHECK(d.Steps == 2 && d.Deadlock);
+  BOOST_CHECK(s.step() == des::Simulator::none);
+  BOOST_CHECK((s.getMarking() == des::Marking{ 0, 0, 1 }));
+  std::vector<uint64_t> sums;
+  s.getTokenSums(sums);
+  BOOST_CHECK((sums == std::vector<uint64_t>{ 1, 1, 1 })); // each state has the token in one of three markings
+}
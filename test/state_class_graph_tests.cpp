@@ -0,0 +1,120 @@
+/*! @file state_class_graph_tests.cpp
+@ref des::StateClassGraph class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <boost/test/unit_test.hpp>
+
+#include "state_class_graph.hpp"
+#include "test_nets.hpp"
+
+
+namespace {
+
+  // Choice between "fast" returning the token by "back" and "slow" stopping in "end".
+  des::Automation makeRace() {
+    des::Automation a;
+    a.addState("p0", 1);
+    a.addState("p1");
+    a.addState("end");
+    a.addEvent("fast", des::EventType::controllable);
+    a.addEvent("back", des::EventType::controllable);
+    a.addEvent("slow", des::EventType::uncontrollable);
+    a.linkStatesByEvent("p0", "fast", "p1");
+    a.linkStatesByEvent("p1", "back", "p0");
+    a.linkStatesByEvent("p0", "slow", "end");
+    return a;
+  }
+
+  // Two concurrent events "a" and "b".
+  des::Automation makeConcurrent() {
+    des::Automation a;
+    a.addState("p", 1);
+    a.addState("q", 1);
+    a.addState("p1");
+    a.addState("q1");
+    a.addEvent("a", des::EventType::controllable);
+    a.addEvent("b", des::EventType::controllable);
+    a.linkStatesByEvent("p", "a", "p1");
+    a.linkStatesByEvent("q", "b", "q1");
+    return a;
+  }
+
+} // namespace
+
+// Test of deadlocks and firing domains under timing constraints.
+BOOST_AUTO_TEST_CASE(StateClassGraphTiming) {
+  const des::CompiledNet race(makeRace());
+  const size_t fast = race.getEventIndex("fast"), back = race.getEventIndex("back"), slow = race.getEventIndex("slow");
+  des::StateClassOptions o;
+  o.Intervals.resize(3);
+  o.Intervals[fast] = { 0, 1 };
+  o.Intervals[back] = { 1, 1 };
+  o.Intervals[slow] = { 2, 3 };
+  auto r = des::StateClassGraph(race, o).build();
+  BOOST_CHECK(r.Complete && r.Bounded == des::Boundedness::bounded);
+  BOOST_CHECK(r.Classes == 2 && r.Edges == 2 && r.Deadlocks == 0); // slow never fires before fast
+  o.Intervals[fast] = { 0, 3 };
+  des::StateClassGraph g(race, o);
+  r = g.build();
+  BOOST_CHECK(r.Deadlocks == 1 && r.DeadlockPath == std::vector<size_t>{ slow });
+  BOOST_CHECK((g.getFiringInterval(0, slow) == des::TimeInterval{ 2, 3 }));
+  BOOST_CHECK_THROW(static_cast<void>(g.getFiringInterval(1, slow)), std::out_of_range);
+
+  const des::CompiledNet concurrent(makeConcurrent());
+  o.Intervals = { { 1, 2 }, { 3, 5 } };
+  des::StateClassGraph sequential(concurrent, o);
+  r = sequential.build();
+  BOOST_CHECK(r.Classes == 3 && r.Edges == 2 && r.Deadlocks == 1); // b can't fire before a
+  BOOST_CHECK((r.DeadlockPath == std::vector<size_t>{ 0, 1 }));
+  BOOST_CHECK((sequential.getFiringInterval(1, 1) == des::TimeInterval{ 1, 4 })); // [3, 5] minus [1, 2]
+  des::Marking m;
+  sequential.getMarking(2, m);
+  BOOST_CHECK((m == des::Marking{ 0, 1, 0, 1 }));
+
+  o.Intervals = { { 1, 1 }, { 1, 1 } };
+  des::StateClassGraph diamond(concurrent, o);
+  r = diamond.build();
+  BOOST_CHECK(r.Classes == 4 && r.Edges == 4 && r.Markings == 4); // both orders reach one final class
+  BOOST_CHECK((diamond.getFiringInterval(1, 1) == des::TimeInterval{ 0, 0 }));
+
+  const des::CompiledNet ring(makeRing(6, 5)); // without timing constraints classes have all reachable markings
+  r = des::StateClassGraph(ring).build();
+  BOOST_CHECK(r.Complete && r.Markings == 252 && r.Bounds[0] == 5);
+
+  o.Intervals = { { 2, 1 } };
+  BOOST_CHECK_THROW(des::StateClassGraph(concurrent, o), std::invalid_argument);
+}
+
+// Test of boundedness verdicts.
+BOOST_AUTO_TEST_CASE(StateClassGraphBoundedness) {
+  des::Automation a;
+  a.addState("p", 1);
+  a.addState("q");
+  a.addEvent("t", des::EventType::controllable);
+  a.setLinkFromStateToEvent("p", "t");
+  a.setLinkFromEventToState("t", "p");
+  a.setLinkFromEventToState("t", "q");
+  const des::CompiledNet n(a);
+  des::StateClassOptions o;
+  o.Intervals = { { 1, 1 } };
+  auto r = des::StateClassGraph(n, o).build();
+  BOOST_CHECK(!r.Complete && r.Bounded == des::Boundedness::unbounded);
+  BOOST_CHECK(r.Classes == 3 && r.Bounds[n.getStateIndex("q")] == 2);
+
+  a.addEvent("u", des::EventType::controllable); // u consumes tokens of q faster than t produces them
+  a.setLinkFromStateToEvent("q", "u");
+  const des::CompiledNet consumed(a);
+  o.Intervals = { { 2, 2 }, { 0, 1 } };
+  r = des::StateClassGraph(consumed, o).build();
+  BOOST_CHECK(r.Complete && r.Bounded == des::Boundedness::bounded);
+  BOOST_CHECK(r.Bounds[consumed.getStateIndex("q")] == 1 && r.Deadlocks == 0);
+  o.Intervals = { { 0, 1 }, { 2, 2 } }; // the untimed net is unbounded too
+  o.MaxClasses = 10;
+  r = des::StateClassGraph(consumed, o).build();
+  BOOST_CHECK(r.Classes <= 10 && r.Bounded != des::Boundedness::bounded && !r.Complete);
+  o.Intervals = { { 1, 1 }, { 0, 0 } };
+  o.MaxClasses = 1;
+  r = des::StateClassGraph(consumed, o).build();
+  BOOST_CHECK(r.Classes == 1 && r.Bounded == des::Boundedness::unknown);
+}
@@ -76,3 +76,16 @@ BOOST_AUTO_TEST_CASE(CompareStates) {
   other_state.viewProperties() = state.viewProperties();
   BOOST_CHECK(state == other_state);
 }
+
+// Test of State layout with view properties in cold storage.
+BOOST_AUTO_TEST_CASE(StateColdStorage) {
+  BOOST_CHECK(sizeof(des::State) <= 2 * sizeof(void*));
+  des::State state(3), touched(3);
+  (void)touched.viewProperties(); // default properties are allocated
+  BOOST_CHECK(state == touched);
+  touched.viewProperties().X = 1.0;
+  des::State copy(touched);
+  touched.viewProperties().X = 2.0; // copies are deep
+  BOOST_CHECK(copy.viewProperties().X == 1.0);
+  BOOST_CHECK(!(copy == touched));
+}
@@ -0,0 +1,102 @@
+/*! @file stochastic_simulator_tests.cpp
+@ref des::StochasticSimulator class tests source file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+
+#include "stochastic_simulator.hpp"
+#include "test_nets.hpp"
+
+
+namespace {
+
+  // Delay with constant value.
+  des::FiringDelay constant(double v) {
+    des::FiringDelay d;
+    d.Type = des::DelayType::deterministic;
+    d.Value = v;
+    return d;
+  }
+
+} // namespace
+
+// Test of firing order and deterministic statistics.
+BOOST_AUTO_TEST_CASE(StochasticSimulatorSteps) {
+  const des::CompiledNet ring(makeRing(6, 5));
+  des::StochasticSimulatorOptions o;
+  o.Delays.resize(3);
+  o.Delays[1].Type = des::DelayType::uniform;
+  o.Delays[1].Min = 0.5;
+  o.Delays[1].Max = 1.5;
+  o.Delays[2].Type = des::DelayType::general;
+  o.Delays[2].Quantile = [](double u) { return u * u; };
+  des::StochasticSimulator s(ring, o);
+  des::Marking m = ring.getInitialMarking(), r;
+  for (int k = 0; k < 2000; k++) {
+    double earliest = std::numeric_limits<double>::infinity();
+    for (size_t t = 0; t < ring.getEventQuantity(); t++) {
+      BOOST_REQUIRE(ring.isReady(m, t) == std::isfinite(s.getFiringTime(t)));
+      earliest = std::min(earliest, s.getFiringTime(t));
+    }
+    const double previous = s.getTime();
+    const size_t t = s.step();
+    BOOST_REQUIRE(s.getTime() == earliest && s.getTime() >= previous); // the earliest event fires
+    ring.fire(m, t, r);
+    m = r;
+    BOOST_REQUIRE(s.getMarking() == m);
+  }
+
+  const des::CompiledNet pair(makeRing(2, 1));
+  o.Delays = { constant(1.0), constant(2.0) };
+  des::StochasticSimulator d(pair, o);
+  auto result = d.run(10);
+  BOOST_CHECK(result.Steps == 10 && result.Time == 15.0 && !result.Deadlock);
+  BOOST_CHECK(std::abs(result.Throughputs[0] - 1.0 / 3) < 1e-12);
+  BOOST_CHECK(std::abs(result.MeanTokens[0] - 1.0 / 3) < 1e-12); // the token waits 1 in p0 and 2 in p1
+  BOOST_CHECK(std::abs(result.BusyShares[1] - 2.0 / 3) < 1e-12);
+  result = d.run(100, 20.0);
+  BOOST_CHECK(result.Steps == 13 && result.Time == 20.0);
+  d.reset();
+  BOOST_CHECK(d.getTime() == 0.0 && d.getFiringTime(0) == 1.0 && std::isinf(d.getFiringTime(1)));
+
+  o.Delays = { constant(-1.0) };
+  BOOST_CHECK_THROW(des::StochasticSimulator(pair, o), std::invalid_argument);
+  o.Delays.resize(3);
+  BOOST_CHECK_THROW(des::StochasticSimulator(pair, o), std::invalid_argument);
+}
+
+// Test of M/M/1 queue statistics.
+BOOST_AUTO_TEST_CASE(StochasticSimulatorQueue) {
+  des::Automation a;
+  a.addState("source", 1);
+  a.addState("queue");
+  a.addEvent("arrive", des::EventType::uncontrollable);
+  a.addEvent("serve", des::EventType::controllable);
+  a.setLinkFromStateToEvent("source", "arrive");
+  a.setLinkFromEventToState("arrive", "source");
+  a.setLinkFromEventToState("arrive", "queue");
+  a.setLinkFromStateToEvent("queue", "serve");
+  const des::CompiledNet n(a);
+  des::StochasticSimulatorOptions o;
+  o.Seed = 5;
+  o.Delays.resize(2);
+  o.Delays[0].Rate = 0.5; // utilization 0.5 with service rate 1
+  des::StochasticSimulator s(n, o);
+  const auto r = s.run(400000);
+  const size_t queue = n.getStateIndex("queue"), serve = n.getEventIndex("serve");
+  BOOST_CHECK(r.BusyShares[queue] > 0.48 && r.BusyShares[queue] < 0.52);
+  BOOST_CHECK(r.MeanTokens[queue] > 0.9 && r.MeanTokens[queue] < 1.1); // utilization / (1 - utilization)
+  BOOST_CHECK(r.Throughputs[serve] > 0.49 && r.Throughputs[serve] < 0.51);
+  BOOST_CHECK(r.BusyShares[n.getStateIndex("source")] == 1.0 && r.FiringsPerSecond > 0.0);
+
+  des::Automation chain = makeRing(2, 1);
+  chain.addEvent("stop", des::EventType::controllable);
+  chain.addState("end");
+  chain.linkStatesByEvent("p1", "stop", "end");
+  const des::CompiledNet c(chain);
+  des::StochasticSimulator d(c);
+  BOOST_CHECK(d.run(1000000).Deadlock && d.getReadyQuantity() == 0);
+}
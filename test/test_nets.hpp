@@ -0,0 +1,33 @@
+/*! @file test_nets.hpp
+Nets shared by tests header file.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#ifndef TEST_NETS_HPP
+#define TEST_NETS_HPP
+
+#include <string>
+
+#include "automation.hpp"
+
+
+/*! Returns a ring of states "p0", "p1" and so on linked by events "t0", "t1" and so on.
+@details The event "tk" moves a token from the state "pk" to the next state of the ring, so the ring is alive, and
+its reachable markings are distributions of the tokens over the states.
+@param n Quantity of states and events.
+@param tokens Activity tokens of the state "p0".
+@return Automation object. */
+inline des::Automation makeRing(unsigned n, unsigned tokens = 1) {
+  des::Automation a;
+  for (unsigned k = 0; k < n; k++) {
+    a.addState("p" + std::to_string(k), k ? 0 : tokens);
+    a.addEvent("t" + std::to_string(k), des::EventType::controllable);
+  }
+  for (unsigned k = 0; k < n; k++) {
+    a.linkStatesByEvent("p" + std::to_string(k), "t" + std::to_string(k), "p" + std::to_string((k + 1) % n));
+  }
+  return a;
+}
+
+
+#endif // TEST_NETS_HPP
@@ -0,0 +1,356 @@
+/*! @file batch_analyse.cpp
+Batch analysis command-line tool source file.
+@details The tool analyses nets in text format (see @ref des::readNet), binary format (see @ref des::MappedNet) or
+PNML (see @ref des::readPnml) from directories, files or a manifest on several worker threads and writes one line of
+JSON or CSV for each net as soon as it's analysed.
+Nets with equal structural fingerprints (see @ref des::Fingerprint) are analysed once, their lines refer to the first
+such net. Results can be kept between runs in a persistent cache (see @ref des::ResultCache). The throughput summary is written into standard error stream.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "analyse.hpp"
+#include "net_binary.hpp"
+#include "net_text.hpp"
+#include "pnml.hpp"
+#include "result_cache.hpp"
+
+
+using namespace std;
+namespace fs = std::filesystem;
+
+namespace {
+
+  // Extensions of text, binary and PNML net files searched in directories.
+  const char* net_extension = ".net";
+  const char* binary_net_extension = ".desb";
+  const char* pnml_extension = ".pnml";
+
+  // Options of the tool.
+  struct BatchOptions {
+    vector<string> Nets;               // paths of nets in order of processing
+    unsigned Jobs = 0;                 // quantity of worker threads, 0 means hardware concurrency
+    des::AnalysisOptions Analysis;     // per-net limits
+    bool Csv = false;                  // CSV instead of JSON lines
+    string Cache;                      // directory of result cache or empty string
+    uint64_t CacheSize = des::default_cache_size;
+  };
+
+  // Result of one net.
+  struct NetResult {
+    des::AnalysisResult Analysis;
+    string Error;
+    string Fingerprint;
+    string DuplicateOf;                // first net with the same fingerprint
+    double Milliseconds = 0.0;
+  };
+
+  void printUsage(ostream& o) {
+    o << "Usage: des-model-batch [options] <directory|file>...\n"
+      << "Analyses Petri nets in text, binary or PNML format, directories are searched for *" << net_extension << ", *"
+      << binary_net_extension << " and *" << pnml_extension << " files.\n"
+      << "  -m, --manifest FILE      file with one net path per line (relative to the manifest)\n"
+      << "  -j, --jobs N             quantity of worker threads (default: hardware concurrency)\n"
+      << "  -t, --time-limit MS      time limit of one net in milliseconds\n"
+      << "  -M, --memory-limit MB    memory limit of one net in megabytes\n"
+      << "  -s, --state-limit N      limit of explored markings of one net\n"
+      << "  -f, --format jsonl|csv   output format (default: jsonl)\n"
+      << "  -c, --cache DIR          directory of persistent result cache\n"
+      << "  -C, --cache-size MB      size limit of the result cache (default: " << (des::default_cache_size >> 20)
+      << ")\n"
+      << "  -h, --help               this help\n";
+  }
+
+  size_t parseCount(const string& o, const string& v) {
+    if (v.empty() || v.find_first_not_of("0123456789") != string::npos) {
+      throw invalid_argument("invalid value of " + o + ": " + v);
+    }
+    return stoull(v);
+  }
+
+  // Adds nets of a directory, a file or a manifest.
+  void addPath(const fs::path& p, vector<string>& nets) {
+    if (fs::is_directory(p)) {
+      vector<string> found;
+      for (const auto& e : fs::recursive_directory_iterator(p)) {
+        if (e.is_regular_file() &&
+          (e.path().extension() == net_extension || e.path().extension() == binary_net_extension ||
+          e.path().extension() == pnml_extension)) {
+          found.push_back(e.path().string());
+        }
+      }
+      sort(found.begin(), found.end());
+      nets.insert(nets.end(), found.begin(), found.end());
+    }
+    else {
+      nets.push_back(p.string());
+    }
+  }
+
+  void addManifest(const fs::path& p, vector<string>& nets) {
+    ifstream f(p);
+    if (!f) {
+      throw invalid_argument("manifest can't be opened: " + p.string());
+    }
+    for (string line; getline(f, line);) {
+      line.erase(0, line.find_first_not_of(" \t"));
+      line.erase(line.find_last_not_of(" \t\r") + 1);
+      if (line.empty() || line[0] == '#') {
+        continue;
+      }
+      const fs::path n(line);
+      addPath(n.is_absolute() ? n : p.parent_path() / n, nets);
+    }
+  }
+
+  BatchOptions parseOptions(int argc, char* argv[]) {
+    BatchOptions result;
+    for (int i = 1; i < argc; i++) {
+      const string a = argv[i];
+      auto value = [&]() -> string {
+        if (i + 1 >= argc) {
+          throw invalid_argument("missing value of " + a);
+        }
+        return argv[++i];
+      };
+      if (a == "-h" || a == "--help") {
+        printUsage(cout);
+        exit(0);
+      }
+      else if (a == "-m" || a == "--manifest") {
+        addManifest(value(), result.Nets);
+      }
+      else if (a == "-j" || a == "--jobs") {
+        result.Jobs = static_cast<unsigned>(parseCount(a, value()));
+      }
+      else if (a == "-t" || a == "--time-limit") {
+        result.Analysis.TimeLimit = chrono::milliseconds(parseCount(a, value()));
+      }
+      else if (a == "-M" || a == "--memory-limit") {
+        result.Analysis.MaxMemory = parseCount(a, value()) << 20;
+      }
+      else if (a == "-s" || a == "--state-limit") {
+        result.Analysis.MaxStates = parseCount(a, value());
+      }
+      else if (a == "-f" || a == "--format") {
+        const string f = value();
+        if (f != "jsonl" && f != "csv") {
+          throw invalid_argument("invalid format: " + f);
+        }
+        result.Csv = f == "csv";
+      }
+      else if (a == "-c" || a == "--cache") {
+        result.Cache = value();
+      }
+      else if (a == "-C" || a == "--cache-size") {
+        result.CacheSize = parseCount(a, value()) << 20;
+      }
+      else if (!a.empty() && a[0] == '-') {
+        throw invalid_argument("unknown option: " + a);
+      }
+      else {
+        addPath(a, result.Nets);
+      }
+    }
+    if (result.Nets.empty()) {
+      throw invalid_argument("no nets to analyse");
+    }
+    return result;
+  }
+
+  string quoteJson(const string& s) {
+    string result = "\"";
+    for (const char c : s) {
+      switch (c) {
+        case '"': result += "\\\""; break;
+        case '\\': result += "\\\\"; break;
+        case '\n': result += "\\n"; break;
+        case '\r': result += "\\r"; break;
+        case '\t': result += "\\t"; break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            snprintf(code, sizeof(code), "\\u%04x", c);
+            result += code;
+          }
+          else {
+            result += c;
+          }
+      }
+    }
+    return result + "\"";
+  }
+
+  string quoteCsv(const string& s) {
+    if (s.find_first_of(",\"\n\r") == string::npos) {
+      return s;
+    }
+    string result = "\"";
+    for (const char c : s) {
+      result += c == '"' ? string("\"\"") : string(1, c);
+    }
+    return result + "\"";
+  }
+
+  const char* csv_header =
+    "net,status,alive,coherent,reachable,safe,states,terminal,memory,ms,fingerprint,duplicate_of,error";
+
+  string formatResult(const string& net, const NetResult& r, bool csv) {
+    const auto& a = r.Analysis;
+    const bool failed = !r.Error.empty();
+    ostringstream o;
+    if (csv) {
+      o << quoteCsv(net) << ',' << (failed ? "error" : des::toString(a.Status)) << ',' << des::toString(a.Alive) << ','
+        << des::toString(a.Coherent) << ',' << des::toString(a.Reachable) << ',' << des::toString(a.Safe) << ','
+        << a.Statistics.States << ',' << a.Statistics.TerminalStates << ',' << a.Statistics.PeakMemory << ','
+        << r.Milliseconds << ',' << r.Fingerprint << ',' << quoteCsv(r.DuplicateOf) << ',' << quoteCsv(r.Error);
+    }
+    else {
+      o << "{\"net\":" << quoteJson(net) << ",\"status\":\"" << (failed ? "error" : des::toString(a.Status)) << '"';
+      if (failed) {
+        o << ",\"error\":" << quoteJson(r.Error);
+      }
+      else {
+        o << ",\"alive\":\"" << des::toString(a.Alive) << "\",\"coherent\":\"" << des::toString(a.Coherent)
+          << "\",\"reachable\":\"" << des::toString(a.Reachable) << "\",\"safe\":\"" << des::toString(a.Safe)
+          << "\",\"states\":" << a.Statistics.States << ",\"terminal\":" << a.Statistics.TerminalStates
+          << ",\"memory\":" << a.Statistics.PeakMemory;
+      }
+      if (!r.Fingerprint.empty()) {
+        o << ",\"fingerprint\":\"" << r.Fingerprint << '"';
+      }
+      if (!r.DuplicateOf.empty()) {
+        o << ",\"duplicate_of\":" << quoteJson(r.DuplicateOf);
+      }
+      o << ",\"ms\":" << r.Milliseconds << '}';
+    }
+    return o.str();
+  }
+
+  double percentile(vector<double> v, double p) {
+    if (v.empty()) {
+      return 0.0;
+    }
+    const size_t k = min(v.size() - 1, static_cast<size_t>(p * static_cast<double>(v.size() - 1) + 0.5));
+    nth_element(v.begin(), v.begin() + static_cast<ptrdiff_t>(k), v.end());
+    return v[k];
+  }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  BatchOptions options;
+  try {
+    options = parseOptions(argc, argv);
+  }
+  catch (const exception& e) {
+    cerr << "des-model-batch: " << e.what() << '\n';
+    printUsage(cerr);
+    return 2;
+  }
+
+  const size_t count = options.Nets.size();
+  unsigned jobs = options.Jobs ? options.Jobs : max(1u, thread::hardware_concurrency());
+  jobs = static_cast<unsigned>(min<size_t>(jobs, count));
+  if (options.Csv) {
+    cout << csv_header << '\n';
+  }
+
+  unique_ptr<des::ResultCache> cache;
+  if (!options.Cache.empty()) {
+    try {
+      cache = make_unique<des::ResultCache>(options.Cache, options.CacheSize);
+      options.Analysis.Cache = cache.get();
+    }
+    catch (const exception& e) {
+      cerr << "des-model-batch: " << e.what() << '\n';
+      return 2;
+    }
+  }
+
+  vector<double> latencies(count, 0.0);
+  atomic<size_t> next(0), failed(0);
+  mutex output;
+  map<des::Fingerprint, pair<size_t, shared_future<des::AnalysisResult>>> analysed; // first nets by fingerprints
+  mutex analysed_mutex;
+  const Analyser analyser;
+  const auto started = chrono::steady_clock::now();
+  auto worker = [&]() {
+    for (size_t i = next++; i < count; i = next++) {
+      const auto net_started = chrono::steady_clock::now();
+      NetResult r;
+      try {
+        const string& path = options.Nets[i];
+        const auto extension = fs::path(path).extension();
+        const des::Automation a = extension == binary_net_extension ? des::MappedNet(path).toAutomation() :
+          (extension == pnml_extension ? des::readPnmlFile(path) : des::readNetFile(path));
+        const des::Fingerprint f = a.fingerprint();
+        r.Fingerprint = f.toString();
+        promise<des::AnalysisResult> analysis;
+        shared_future<des::AnalysisResult> known;
+        {
+          lock_guard<mutex> lock(analysed_mutex);
+          const auto it = analysed.find(f);
+          if (it == analysed.end()) {
+            analysed.emplace(f, make_pair(i, analysis.get_future().share()));
+          }
+          else {
+            known = it->second.second;
+            r.DuplicateOf = options.Nets[it->second.first];
+          }
+        }
+        if (known.valid()) {
+          r.Analysis = known.get(); // the first net is analysed by other worker or has been analysed
+        }
+        else {
+          try {
+            r.Analysis = analyser.run_analyse(a, options.Analysis);
+            analysis.set_value(r.Analysis);
+          }
+          catch (...) {
+            analysis.set_exception(current_exception());
+            throw;
+          }
+        }
+      }
+      catch (const exception& e) {
+        r.Error = e.what();
+        failed++;
+      }
+      r.Milliseconds = chrono::duration<double, milli>(chrono::steady_clock::now() - net_started).count();
+      latencies[i] = r.Milliseconds;
+      const string line = formatResult(options.Nets[i], r, options.Csv);
+      lock_guard<mutex> lock(output);
+      cout << line << endl; // every result is visible as soon as the net is analysed
+    }
+  };
+  vector<thread> pool;
+  for (unsigned t = 1; t < jobs; t++) {
+    pool.emplace_back(worker);
+  }
+  worker();
+  for (auto& t : pool) {
+    t.join();
+  }
+
+  const double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+  cerr << "nets " << count << ", failed " << failed << ", threads " << jobs << ", elapsed " << seconds << " s, "
+    << (seconds > 0 ? static_cast<double>(count) / seconds : 0.0) << " nets/s, latency p50 "
+    << percentile(latencies, 0.50) << " ms, p99 " << percentile(latencies, 0.99) << " ms" << endl;
+  return failed ? 1 : 0;
+}
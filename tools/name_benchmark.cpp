@@ -0,0 +1,82 @@
+/*! @file name_benchmark.cpp
+Benchmark of name string check source file.
+@details The tool compares @ref des::checkNameString with the regular expression of names, which was used by the
+function before, on generated valid and invalid names of several lengths and prints nanoseconds per check.
+@authors A. Kozov
+@date 2026/10/18 */
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "components.hpp"
+
+
+using namespace std;
+
+namespace {
+
+  // Quantity of names in one set and repetitions of checks.
+  const size_t name_quantity = 10000;
+  const size_t repetitions = 20;
+
+  // Names of the specified length, every fourth name has an invalid character.
+  vector<string> makeNames(size_t n, mt19937& g) {
+    const string letters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    const string others = letters + "0123456789_/";
+    vector<string> result;
+    result.reserve(name_quantity);
+    for (size_t k = 0; k < name_quantity; k++) {
+      string s(1, letters[g() % letters.size()]);
+      while (s.size() < n) {
+        s += others[g() % others.size()];
+      }
+      if (k % 4 == 3) {
+        s[g() % n] = '-';
+      }
+      result.push_back(std::move(s));
+    }
+    return result;
+  }
+
+  // Nanoseconds per check and quantity of valid names.
+  template<class F>
+  pair<double, size_t> measure(const vector<string>& names, F check) {
+    size_t valid = 0;
+    const auto started = chrono::steady_clock::now();
+    for (size_t r = 0; r < repetitions; r++) {
+      for (const auto& s : names) {
+        valid += check(s) ? 1 : 0;
+      }
+    }
+    const double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - started).count();
+    return { ns / static_cast<double>(repetitions * names.size()), valid / repetitions };
+  }
+
+} // namespace
+
+int main() {
+  const regex r("[[:alpha:]][[:alpha:][:digit:]_/]*");
+  auto byRegex = [&r](const string& s) { return s.length() < des::max_name_length && regex_match(s, r); };
+  auto byTable = [](const string& s) { return des::checkNameString(s); };
+  mt19937 g(2026);
+  cout << "length  regex, ns  table, ns  speedup\n";
+  for (const size_t n : { 4, 16, 64, 255 }) {
+    const auto names = makeNames(n, g);
+    const auto old_result = measure(names, byRegex);
+    const auto new_result = measure(names, byTable);
+    if (old_result.second != new_result.second) {
+      cerr << "results differ for length " << n << '\n';
+      return 1;
+    }
+    char line[80];
+    snprintf(line, sizeof(line), "%6zu %10.1f %10.1f %8.1f\n", n, old_result.first, new_result.first,
+      old_result.first / new_result.first);
+    cout << line;
+  }
+  return 0;
+}